@@ -3,65 +3,45 @@
 
 #include <iostream>
 #include <fstream>
-#include <sstream>
 #include <vector>
 #include <queue>
 #include <chrono>
+#include <memory>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/breadth_first_search.hpp>
 
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
 using namespace std;
 
 class BFSBgl {
 public:
-    using BoostGraph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
+    using BoostGraph = GraphStore::BoostGraph;
     using Vertex = boost::graph_traits<BoostGraph>::vertex_descriptor;
 
 private:
-    BoostGraph boostGraph;
-    std::vector<std::vector<int>> adjList;
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    const BoostGraph *boostGraph = nullptr;
     int num_nodes = 0;
     int edge_count = 0;
     std::vector<int> distances;
 
 public:
     void readGraphFromFile(const std::string& filename) {
-        std::ifstream file(filename);
-        if (!file.is_open()) {
-            std::cerr << "Dosya açılamadı: " << filename << std::endl;
-            exit(1);
-        }
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
 
-        std::string line;
-        while (getline(file, line)) {
-            if (line[0] == 'c') continue; 
-            
-            if (line[0] == 'p') {
-                std::stringstream ss(line);
-                std::string tmp;
-                ss >> tmp >> tmp >> num_nodes >> edge_count;
-                
-                adjList.resize(num_nodes);
-                boostGraph = BoostGraph(num_nodes + 1);
-            } 
-            else if (line[0] == 'a') {
-                std::stringstream ss(line);
-                char a;
-                int u, v;
-                ss >> a >> u >> v;
-                --v;
-                --u;
-                adjList[u].push_back(v);
-                adjList[v].push_back(u);
-                
-                boost::add_edge(u, v, boostGraph);
-            }
-        }
-        file.close();
+    // Uses the store's BGL graph, shared with the other engines
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        boostGraph = &store.boostGraph();
     }
 
     void compute(const std::string& outputFile, int iterations = 10) { 
-        std::ofstream file(outputFile);
+        ResultWriter file(outputFile);
         if (!file.is_open()) {
             std::cerr << "Dosya açılamadı: " << outputFile << std::endl;
             return;
@@ -90,7 +70,7 @@ public:
             while (!bfsQueue.empty()) {
                 Vertex currentVertex = bfsQueue.front();
                 bfsQueue.pop();
-                for (auto [neighborIt, neighborEnd] = boost::adjacent_vertices(currentVertex, boostGraph);
+                for (auto [neighborIt, neighborEnd] = boost::adjacent_vertices(currentVertex, *boostGraph);
                      neighborIt != neighborEnd; ++neighborIt) {
                     Vertex neighbor = *neighborIt;
                     if (distances[neighbor] == -1) {
@@ -107,12 +87,7 @@ public:
             
             // Sadece ilk çalıştırmada dosyaya yaz
             if (i == 0) {
-                for (int v = 0; v < num_nodes; ++v) {
-                    if (v != startVertex) {
-                        file << "Node " << startVertex << " -> " << v
-                        << " shortest distance: " << distances[v] << "\n";
-                    }
-                }
+                writeResultArray(file, outputFile, ResultKind::Distance, startVertex, distances);
             }
         }
         
@@ -0,0 +1,205 @@
+#ifndef BFS_BIDIR_HPP
+#define BFS_BIDIR_HPP
+
+// Point-to-point shortest path with bidirectional frontier-bitset BFS
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+#include "../graphLib/bitMatrix.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+// Hop distance and one shortest path s -> t (both ends included);
+// distance -1 and an empty path when t is unreachable
+struct PathResult {
+    int distance = -1;
+    vector<int> path;
+    int touched = 0; // vertices visited by the two searches together
+};
+
+class BFSBidir {
+private:
+    // One direction of the search. dist/parent are only reset where they
+    // were written, so a query costs what it touches plus O(N / 64).
+    struct Side {
+        vector<uint64_t> visited, frontier, next;
+        vector<int> dist, parent;
+        int level = 0;
+        size_t frontier_size = 0;
+    };
+
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    BitMatrix<Block64> edges;
+    int num_nodes;
+    int edge_count;
+    size_t block_num;
+    const bit_kernels *kernels;
+    Side sides[2];
+
+    void start(Side& side, int root) {
+        std::fill(side.visited.begin(), side.visited.end(), 0);
+        std::fill(side.frontier.begin(), side.frontier.end(), 0);
+        Block64::set(side.visited.data(), root);
+        Block64::set(side.frontier.data(), root);
+        side.dist[root] = 0;
+        side.parent[root] = -1;
+        side.level = 0;
+        side.frontier_size = 1;
+    }
+
+    // Grows one level; a new vertex gets the first frontier vertex whose
+    // row reached it as parent
+    void expand(Side& side) {
+        std::fill(side.next.begin(), side.next.end(), 0);
+        ++side.level;
+        for (size_t fb = 0; fb < block_num; ++fb) {
+            uint64_t fbits = side.frontier[fb];
+            while (fbits) {
+                const int u = fb * 64 + __builtin_ctzll(fbits);
+                const uint64_t *row = edges.row(u);
+                for (size_t b = 0; b < block_num; ++b) {
+                    uint64_t fresh = row[b] & ~(side.visited[b] | side.next[b]);
+                    if (!fresh) continue;
+                    side.next[b] |= fresh;
+                    while (fresh) {
+                        const int v = b * 64 + __builtin_ctzll(fresh);
+                        side.dist[v] = side.level;
+                        side.parent[v] = u;
+                        fresh &= fresh - 1;
+                    }
+                }
+                fbits &= fbits - 1;
+            }
+        }
+        kernels->or_into(side.visited.data(), side.next.data(), block_num);
+        side.frontier.swap(side.next);
+        side.frontier_size = kernels->popcount(side.frontier.data(), block_num);
+    }
+
+    void clear(Side& side) {
+        for (size_t b = 0; b < block_num; ++b) {
+            uint64_t bits = side.visited[b];
+            while (bits) {
+                const int v = b * 64 + __builtin_ctzll(bits);
+                side.dist[v] = -1;
+                side.parent[v] = -1;
+                bits &= bits - 1;
+            }
+        }
+    }
+
+public:
+    BFSBidir() : num_nodes(0), edge_count(0), block_num(0), kernels(bit_kernels_get()) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Bit-matrix rows shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        edges = store.bitMatrix<Block64>();
+
+        block_num = Block64::blockCount(num_nodes);
+        for (Side &side : sides) {
+            side.visited.assign(block_num, 0);
+            side.frontier.assign(block_num, 0);
+            side.next.assign(block_num, 0);
+            side.dist.assign(num_nodes, -1);
+            side.parent.assign(num_nodes, -1);
+        }
+    }
+
+    // Expands the side with the smaller frontier until the new level meets
+    // the other side's visited set (one AND per block). With A at level a
+    // and B at level b, the sets were disjoint before, so d(s, t) >= a + b
+    // and every meeting vertex gives a path of exactly that length.
+    PathResult shortestPath(int s, int t) {
+        PathResult result;
+        Side &src = sides[0], &dst = sides[1];
+        start(src, s);
+        start(dst, t);
+
+        int meet = s == t ? s : -1;
+        while (meet < 0 && src.frontier_size && dst.frontier_size) {
+            const bool fromSource = src.frontier_size <= dst.frontier_size;
+            Side &grow = fromSource ? src : dst;
+            const Side &other = fromSource ? dst : src;
+            expand(grow);
+            for (size_t b = 0; b < block_num; ++b) {
+                if (uint64_t both = grow.frontier[b] & other.visited[b]) {
+                    meet = b * 64 + __builtin_ctzll(both);
+                    break;
+                }
+            }
+        }
+
+        if (meet >= 0) {
+            result.distance = src.dist[meet] + dst.dist[meet];
+            for (int v = meet; v >= 0; v = src.parent[v]) result.path.push_back(v);
+            std::reverse(result.path.begin(), result.path.end());
+            for (int v = dst.parent[meet]; v >= 0; v = dst.parent[v]) result.path.push_back(v);
+        }
+        result.touched = (int)(kernels->popcount(src.visited.data(), block_num) +
+                               kernels->popcount(dst.visited.data(), block_num));
+        clear(src);
+        clear(dst);
+        return result;
+    }
+
+    // Times one query per target 0 -> j; result.txt gets the per-query average
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        int start_node = 0;
+        double total_time = 0.0;
+        long touched = 0;
+        vector<int> distances(num_nodes, 0); // first run's answers, written after its timer stops
+
+        for (int i = 0; i < iterations; i++) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            for (int j = 0; j < num_nodes; j++) {
+                if (j == start_node) continue;
+                PathResult r = shortestPath(start_node, j);
+                if (i == 0) {
+                    touched += r.touched;
+                    distances[j] = r.distance;
+                }
+            }
+            auto end_time = std::chrono::high_resolution_clock::now();
+            total_time += std::chrono::duration<double>(end_time - start_time).count();
+
+            if (i == 0) {
+                writeResultArray(file, output_filename, ResultKind::Distance, start_node, distances);
+            }
+        }
+
+        const int query_num = std::max(1, num_nodes - 1);
+        double avg = total_time / iterations / query_num;
+        std::cout << "BTW Bidir Avarage: " << avg << " second per query (touched "
+                  << 100.0 * touched / query_num / std::max(1, num_nodes) << "% of vertices)\n";
+        file.close();
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "Btw Bidir : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif // BFS_BIDIR_HPP
@@ -0,0 +1,164 @@
+#ifndef BFS_BITWISE_FIXED_HPP
+#define BFS_BITWISE_FIXED_HPP
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <variant>
+#include <fstream>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "bfsBtwTemp.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/sizeBuckets.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+// Frontier-bitset BFS for graphs of at most W * 64 vertices. Rows are
+// std::array<uint64_t, W> so every row loop has a compile time trip count
+// and is fully unrolled; visited/frontier/next live on the stack.
+template <size_t W>
+class BFSBtwFixed {
+public:
+    using Row = std::array<uint64_t, W>;
+
+private:
+    int num_nodes;
+    vector<Row> edges;
+
+public:
+    BFSBtwFixed() : num_nodes(0) {}
+    explicit BFSBtwFixed(const EdgeSpan& stream) : num_nodes(stream.num_nodes), edges(stream.num_nodes, Row{}) {
+        for (const Edge &e : stream.edges) {
+            edges[e.u][e.v / 64] |= (uint64_t)1 << (e.v % 64);
+            edges[e.v][e.u / 64] |= (uint64_t)1 << (e.u % 64);
+        }
+    }
+
+    void bfs(int start, vector<int>& dist) const {
+        dist.assign(num_nodes, -1);
+        Row visited{}, frontier{}, next;
+
+        dist[start] = 0;
+        visited[start / 64] |= (uint64_t)1 << (start % 64);
+        frontier = visited;
+
+        for (int level = 1; ; ++level) {
+            next.fill(0);
+#pragma GCC unroll 16
+            for (size_t fb = 0; fb < W; ++fb) {
+                uint64_t fbits = frontier[fb];
+                while (fbits) {
+                    const Row &row = edges[fb * 64 + __builtin_ctzll(fbits)];
+#pragma GCC unroll 16
+                    for (size_t b = 0; b < W; ++b) next[b] |= row[b];
+                    fbits &= fbits - 1;
+                }
+            }
+
+            uint64_t any = 0;
+#pragma GCC unroll 16
+            for (size_t b = 0; b < W; ++b) {
+                next[b] &= ~visited[b];
+                visited[b] |= next[b];
+                any |= next[b];
+            }
+            if (!any) break;
+
+#pragma GCC unroll 16
+            for (size_t b = 0; b < W; ++b) {
+                uint64_t bits = next[b];
+                while (bits) {
+                    dist[b * 64 + __builtin_ctzll(bits)] = level;
+                    bits &= bits - 1;
+                }
+            }
+            frontier = next;
+        }
+    }
+};
+
+// Loads the graph into the smallest size bucket that fits; graphs above
+// 1024 vertices fall back to the frontier-bitset mode of BFSBtwTemp.
+class BFSBtwSmall {
+private:
+    using Engine = std::variant<std::monostate, BFSBtwFixed<1>, BFSBtwFixed<2>, BFSBtwFixed<4>,
+                                BFSBtwFixed<8>, BFSBtwFixed<16>>;
+    Engine engine;
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    BFSBtwTemp fallback;
+    int num_nodes;
+    int edge_count;
+    int bucket; // vertex capacity of the chosen bucket, 0 = fallback
+
+public:
+    BFSBtwSmall() : fallback(BtwMode::FrontierBitset), num_nodes(0), edge_count(0), bucket(0) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Fixed-size engine built from the store's edge list; graphs too big
+    // for it go to the fallback, which shares the store's bit-matrix
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        bool fits = withSizeBucket(num_nodes, [&](auto words) {
+            engine.emplace<BFSBtwFixed<decltype(words)::value>>(store.edges());
+            bucket = decltype(words)::value * 64;
+        });
+        if (!fits) {
+            engine.emplace<std::monostate>();
+            bucket = 0;
+            fallback.readGraph(store);
+        }
+    }
+
+    void bfs(int start, vector<int>& dist) {
+        std::visit([&](auto &e) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(e)>, std::monostate>) dist = fallback.run(start);
+            else e.bfs(start, dist);
+        }, engine);
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            std::cerr << "Sonuç dosyası açılamadı!" << std::endl;
+            return;
+        }
+
+        int start_node = 0;
+        double total_time = 0.0;
+        vector<int> distances;
+
+        for (int i = 0; i < iterations; i++) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            bfs(start_node, distances);
+            auto end_time = std::chrono::high_resolution_clock::now();
+            total_time += std::chrono::duration<double>(end_time - start_time).count();
+
+            if (i == 0) {
+                writeResultArray(file, output_filename, ResultKind::Distance, start_node, distances);
+            }
+        }
+
+        double avg = total_time / iterations;
+        std::cout << "BTW Fixed (bucket " << (bucket ? std::to_string(bucket) : std::string("fallback"))
+                  << ") Avarage: " << avg << " second\n";
+        file.close();
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "Btw Fixed : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif // BFS_BITWISE_FIXED_HPP
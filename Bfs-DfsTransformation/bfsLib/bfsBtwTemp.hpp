@@ -5,55 +5,93 @@
 #include <vector>
 #include <queue>
 #include <fstream>
-#include <sstream>
 #include <chrono>
 #include <cstdint>
+#include <string>
+#include <memory>
 
-// Bitwise implementation from custom implementation
-#define block_t uint64_t
-#define BLOCK_INDEX(bit_index) ((bit_index)/(sizeof(block_t)*8))
-#define MASK_INDEX(bit_index) ((bit_index)%(sizeof(block_t)*8))
-#define MASK(bit_index) ((block_t)1 << MASK_INDEX(bit_index))
-#define TOTAL_BLOCK_NUM(vertex_num) (BLOCK_INDEX(vertex_num-1)+1)
-#define SET_EDGE(vertex1, vertex2, edges) edges[vertex1][BLOCK_INDEX(vertex2)] |= MASK(vertex2); edges[vertex2][BLOCK_INDEX(vertex1)] |= MASK(vertex1);
+#include "../graphLib/bitMatrix.hpp"
+#include "../graphLib/compactDistances.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+// Direction-optimizing switch thresholds (Beamer et al.)
+#define DO_ALPHA 14
+#define DO_BETA 24
 
 using namespace std;
 
-class BFSBtwTemp {
+enum class BtwMode {
+    TopDown,             // queue based expansion (default)
+    DirectionOptimizing, // top-down / bottom-up chosen per level
+    FrontierBitset       // queue-free, whole level expanded with word operations
+};
+
+// Bitwise implementation from custom implementation, Block picks the word
+// width of the rows (see graphLib/blockPolicy.hpp)
+template <typename Block = Block64>
+class BFSBtwTempT {
+public:
+    using block_t = typename Block::type;
+
 private:
     int num_nodes;
     int edge_count;
-    vector<vector<block_t>> edges; // bitwise operations
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    BitMatrix<Block> edges; // bitwise operations
+    vector<int> degrees;
+    BtwMode mode;
+    std::string levelDirections; // 'T' top-down, 'B' bottom-up, one char per level
+    const bit_kernels *kernels;  // row kernels picked for this CPU
+
+    // next = (OR of frontier rows) & ~visited; onLevel(level, next) is
+    // called once per non-empty level, starting at level 1
+    template <typename OnLevel>
+    void frontier_levels(int start, OnLevel&& onLevel) {
+        const size_t block_num = Block::blockCount(num_nodes);
+        std::vector<block_t> visited(block_num, Block::zero()), frontier(block_num, Block::zero()),
+                             next(block_num, Block::zero());
+
+        Block::set(visited.data(), start);
+        Block::set(frontier.data(), start);
+
+        for (int level = 1; ; ++level) {
+            std::fill(next.begin(), next.end(), Block::zero());
+            for (size_t fb = 0; fb < block_num; ++fb) {
+                block_t fbits = frontier[fb];
+                while (Block::any(fbits)) {
+                    Block::rowOr(kernels, next.data(), edges.row(fb * Block::bits + Block::ctz(fbits)), block_num);
+                    fbits = Block::clearLowest(fbits);
+                }
+            }
+
+            Block::rowAndNot(kernels, next.data(), visited.data(), block_num);
+            if (!Block::rowAny(kernels, next.data(), block_num)) break;
+            Block::rowOr(kernels, visited.data(), next.data(), block_num);
+            onLevel(level, next.data());
+            frontier.swap(next);
+        }
+    }
 
 public:
-    BFSBtwTemp() : num_nodes(0), edge_count(0) {}
+    BFSBtwTempT(BtwMode mode = BtwMode::TopDown)
+        : num_nodes(0), edge_count(0), mode(mode), kernels(bit_kernels_get()) {}
 
     void readGraphFromFile(const std::string& filename) {
-        std::ifstream file(filename);
-        if (!file.is_open()) {
-            std::cerr << "Dosya açılamadı: " << filename << std::endl;
-            exit(1);
-        }
-        
-        std::string line;
-        while (std::getline(file, line)) {
-            if (line[0] == 'c') continue; // Yorum satırlarını atla
-            if (line[0] == 'p') {
-                std::stringstream ss(line);
-                std::string tmp;
-                ss >> tmp >> tmp >> num_nodes >> edge_count;
-                edges.resize(num_nodes, std::vector<block_t>(TOTAL_BLOCK_NUM(num_nodes), 0)); // bitwise matrix 
-            } else if (line[0] == 'a') {
-                std::stringstream ss(line);
-                char a;
-                int u, v;
-                ss >> a >> u >> v;
-                u--; // 1 tabanlıdan 0 tabanlıya
-                v--;
-                SET_EDGE(u, v, edges);
-            }
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Bit-matrix rows shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        edges = store.bitMatrix<Block>(); // bitwise matrix
+
+        degrees.assign(num_nodes, 0);
+        for (int u = 0; u < num_nodes; ++u) {
+            degrees[u] = (int)Block::rowPopcount(kernels, edges.row(u), edges.blocksPerRow());
         }
-        file.close();
     }
 
     std::vector<int> bfs_matrix(int start) {
@@ -66,26 +104,132 @@ public:
             int node = q.front();
             q.pop();
             
-            const auto &row = edges[node];
-            for (size_t block_index = 0; block_index < row.size(); ++block_index) {
+            const block_t *row = edges.row(node);
+            for (size_t block_index = 0; block_index < edges.blocksPerRow(); ++block_index) {
                 block_t bits = row[block_index];
-                while (bits) {
-                    int offset = __builtin_ctzll(bits);
-                    int v = block_index * 64 + offset;
+                while (Block::any(bits)) {
+                    int offset = Block::ctz(bits);
+                    int v = block_index * Block::bits + offset;
                     if (v >= num_nodes) break;
                     if (dist[v] == -1) {
                         dist[v] = dist[node] + 1;
                         q.push(v);
                     }
-                    bits &= bits - 1; // işlenen biti sıfırla
+                    bits = Block::clearLowest(bits); // işlenen biti sıfırla
+                }
+            }
+        }
+        return dist;
+    }
+
+    // Switches to bottom-up when the frontier's edges outweigh the unexplored
+    // edges, and back to top-down once the frontier shrinks again.
+    std::vector<int> bfs_direction_optimizing(int start) {
+        std::vector<int> dist(num_nodes, -1);
+        const size_t block_num = Block::blockCount(num_nodes);
+        std::vector<block_t> frontierBits(block_num, Block::zero());
+        std::vector<int> frontier, next;
+        levelDirections.clear();
+
+        long long unexploredEdges = 0;
+        for (int d : degrees) unexploredEdges += d;
+        dist[start] = 0;
+        frontier.push_back(start);
+        unexploredEdges -= degrees[start];
+        long long frontierEdges = degrees[start];
+
+        bool bottomUp = false;
+        size_t prevFrontierSize = 0;
+        int level = 0;
+        while (!frontier.empty()) {
+            if (!bottomUp) {
+                bottomUp = frontierEdges > unexploredEdges / DO_ALPHA
+                           && frontier.size() > prevFrontierSize;
+            } else if (frontier.size() < (size_t)num_nodes / DO_BETA && frontier.size() < prevFrontierSize) {
+                bottomUp = false;
+            }
+            levelDirections.push_back(bottomUp ? 'B' : 'T');
+
+            next.clear();
+            if (bottomUp) {
+                std::fill(frontierBits.begin(), frontierBits.end(), Block::zero());
+                for (int u : frontier) Block::set(frontierBits.data(), u);
+
+                for (int v = 0; v < num_nodes; ++v) {
+                    if (dist[v] != -1) continue;
+                    if (Block::rowIntersects(kernels, edges.row(v), frontierBits.data(), block_num)) { // ilk komşu yeterli
+                        dist[v] = level + 1;
+                        next.push_back(v);
+                    }
+                }
+            } else {
+                for (int node : frontier) {
+                    const block_t *row = edges.row(node);
+                    for (size_t block_index = 0; block_index < block_num; ++block_index) {
+                        block_t bits = row[block_index];
+                        while (Block::any(bits)) {
+                            int v = block_index * Block::bits + Block::ctz(bits);
+                            if (dist[v] == -1) {
+                                dist[v] = level + 1;
+                                next.push_back(v);
+                            }
+                            bits = Block::clearLowest(bits);
+                        }
+                    }
                 }
             }
+
+            frontierEdges = 0;
+            for (int v : next) frontierEdges += degrees[v];
+            unexploredEdges -= frontierEdges;
+            prevFrontierSize = frontier.size();
+            frontier.swap(next);
+            ++level;
         }
         return dist;
     }
 
+    // Distances assigned from each level bitset in one sweep
+    std::vector<int> bfs_frontier_bitset(int start) {
+        std::vector<int> dist(num_nodes, -1);
+        dist[start] = 0;
+        frontier_levels(start, [&](int level, const block_t *next) {
+            for (size_t b = 0; b < Block::blockCount(num_nodes); ++b) {
+                block_t bits = next[b];
+                while (Block::any(bits)) {
+                    dist[b * Block::bits + Block::ctz(bits)] = level;
+                    bits = Block::clearLowest(bits);
+                }
+            }
+        });
+        return dist;
+    }
+
+    // Frontier-bitset BFS that keeps the level bitsets themselves instead
+    // of a distance per vertex (see graphLib/compactDistances.hpp)
+    LevelDistances<Block> bfs_levels(int start) {
+        LevelDistances<Block> result;
+        result.reset(num_nodes);
+        std::vector<block_t> root(Block::blockCount(num_nodes), Block::zero());
+        Block::set(root.data(), start);
+        result.appendLevel(root.data());
+        frontier_levels(start, [&](int, const block_t *next) { result.appendLevel(next); });
+        return result;
+    }
+
+    // Direction used by each level of the last direction-optimizing run.
+    const std::string& getLevelDirections() const { return levelDirections; }
+
+    std::vector<int> run(int start) {
+        switch (mode) {
+            case BtwMode::DirectionOptimizing: return bfs_direction_optimizing(start);
+            case BtwMode::FrontierBitset: return bfs_frontier_bitset(start);
+            default: return bfs_matrix(start);
+        }
+    }
+
     void compute(const std::string& output_filename, int iterations = 10) {
-        std::ofstream file(output_filename);
+        ResultWriter file(output_filename);
         if (!file.is_open()) {
             std::cerr << "Sonuç dosyası açılamadı!" << std::endl;
             return;
@@ -96,32 +240,43 @@ public:
         
         for (int i = 0; i < iterations; i++) {
             auto start_time = std::chrono::high_resolution_clock::now();
-            std::vector<int> distances = bfs_matrix(start_node);
+            std::vector<int> distances = run(start_node);
             auto end_time = std::chrono::high_resolution_clock::now();
             double elapsed_time = std::chrono::duration<double>(end_time - start_time).count();
             total_time_custom += elapsed_time; 
             
             if (i == 0) {
-                for (int j = 0; j < num_nodes; j++) {
-                    if (j != start_node) {
-                        file << "Node " << start_node << " -> " << j
-                             << " shortest distance: " << distances[j] << "\n";
-                    } 
+                writeResultArray(file, output_filename, ResultKind::Distance, start_node, distances);
+                if (mode == BtwMode::DirectionOptimizing) {
+                    for (size_t level = 0; level < levelDirections.size(); ++level) {
+                        file << "Level " << level << " direction: "
+                             << (levelDirections[level] == 'B' ? "bottom-up" : "top-down") << "\n";
+                    }
                 }
             }
         }
         
         double avg_custom = total_time_custom / iterations;
-        std::cout << "BTW Temp Avarage: " << avg_custom << " second\n";
+        std::string label = "Btw";
+        if (Block::bits != 64) label += Block::name;
+        if (mode == BtwMode::DirectionOptimizing) label += " DO";
+        if (mode == BtwMode::FrontierBitset) label += " FB";
+        if (mode == BtwMode::DirectionOptimizing) {
+            std::cout << "BTW DO levels: " << levelDirections << "\n";
+        }
+        std::cout << (label == "Btw" ? "BTW Temp" : label)
+                  << " Avarage: " << avg_custom << " second\n";
         file.close();
         ofstream file2("result.txt",  ios::app);
         if (!file2.is_open()) {
             cerr << "File couldn't open!" << endl;
             return;
         }
-        file2 << "Btw : " << avg_custom << " s" << endl;
+        file2 << label << " : " << avg_custom << " s" << endl;
         file2.close();
     } 
 };
 
+using BFSBtwTemp = BFSBtwTempT<Block64>;
+
 #endif // BFS_BITWISE_H
@@ -0,0 +1,277 @@
+#ifndef BFS_COMPONENTS_HPP
+#define BFS_COMPONENTS_HPP
+
+// Connected components of the whole graph: a word-parallel flood fill on
+// the bit matrix and a multithreaded Afforest variant on CSR storage
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <atomic>
+#include <random>
+#include <unordered_map>
+#include <memory>
+
+#include "../graphLib/bitMatrix.hpp"
+#include "../graphLib/csrGraph.hpp"
+#include "../graphLib/threadPool.hpp"
+#include "../graphLib/components.hpp"
+#include "../graphLib/graphStore.hpp"
+
+// Afforest tuning: neighbour rounds before sampling, vertices sampled to
+// guess the giant component
+#define CC_NEIGHBOR_ROUNDS 2
+#define CC_SAMPLE_NUM 1024
+
+using namespace std;
+
+// Flood fill with whole rows: the rows of the vertices reached last are
+// OR'ed into one bitset, masked with the assigned set, and the result is
+// the next frontier. Seeds are taken from the assigned set in ascending
+// order, so no per-vertex queue is ever built.
+template <typename Block = Block64>
+class CCBtwT {
+public:
+    using block_t = typename Block::type;
+
+private:
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    BitMatrix<Block> edges;
+    int num_nodes;
+    int edge_count;
+    const bit_kernels *kernels;
+
+public:
+    CCBtwT() : num_nodes(0), edge_count(0), kernels(bit_kernels_get()) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Bit-matrix rows shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        edges = store.bitMatrix<Block>();
+    }
+
+    Components components() {
+        const size_t block_num = Block::blockCount(num_nodes);
+        vector<block_t> assigned(block_num, Block::zero());
+        vector<block_t> frontier(block_num, Block::zero());
+        vector<block_t> next(block_num, Block::zero());
+        // Padding bits count as assigned so the seed search never returns them
+        for (int i = num_nodes; i < (int)(block_num * Block::bits); ++i) Block::set(assigned.data(), i);
+
+        Components result;
+        result.id.assign(num_nodes, -1);
+        size_t seed_block = 0;
+
+        while (true) {
+            while (seed_block < block_num && !Block::any(~assigned[seed_block])) ++seed_block;
+            if (seed_block == block_num) break;
+            const int seed = seed_block * Block::bits + Block::ctz(~assigned[seed_block]);
+            const int comp = (int)result.sizes.size();
+            int size = 1;
+
+            std::fill(frontier.begin(), frontier.end(), Block::zero());
+            Block::set(frontier.data(), seed);
+            Block::set(assigned.data(), seed);
+            result.id[seed] = comp;
+
+            while (true) {
+                std::fill(next.begin(), next.end(), Block::zero());
+                for (size_t b = 0; b < block_num; ++b) {
+                    block_t bits = frontier[b];
+                    while (Block::any(bits)) {
+                        Block::rowOr(kernels, next.data(), edges.row(b * Block::bits + Block::ctz(bits)), block_num);
+                        bits = Block::clearLowest(bits);
+                    }
+                }
+                Block::rowAndNot(kernels, next.data(), assigned.data(), block_num);
+                if (!Block::rowAny(kernels, next.data(), block_num)) break;
+
+                Block::rowOr(kernels, assigned.data(), next.data(), block_num);
+                size += (int)Block::rowPopcount(kernels, next.data(), block_num);
+                for (size_t b = 0; b < block_num; ++b) {
+                    block_t bits = next[b];
+                    while (Block::any(bits)) {
+                        result.id[b * Block::bits + Block::ctz(bits)] = comp;
+                        bits = Block::clearLowest(bits);
+                    }
+                }
+                frontier.swap(next);
+            }
+            result.sizes.push_back(size);
+        }
+        return result;
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        double total_time = 0.0;
+        Components result;
+        for (int i = 0; i < iterations; i++) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            result = components();
+            auto end_time = std::chrono::high_resolution_clock::now();
+            total_time += std::chrono::duration<double>(end_time - start_time).count();
+            if (i == 0) result.write(output_filename);
+        }
+
+        double avg = total_time / iterations;
+        std::cout << "BTW CC Avarage: " << avg << " second (" << result.sizes.size() << " components)\n";
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "Btw CC : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+using CCBtw = CCBtwT<Block64>;
+
+// Afforest (Sutton et al.) over CSR: union-find parents are linked with
+// CAS, first from a few neighbours of every vertex, then the component
+// most sampled vertices already sit in is skipped while the remaining
+// edges are linked. On sparse graphs with a giant component most edges
+// are never touched.
+class CCPar {
+private:
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    CSRView graph;
+    int num_nodes;
+    int edge_count;
+    int max_threads;
+
+    // Hooks the higher root under the lower one
+    static void link(vector<std::atomic<int>>& comp, int u, int v) {
+        int p1 = comp[u].load(std::memory_order_relaxed);
+        int p2 = comp[v].load(std::memory_order_relaxed);
+        while (p1 != p2) {
+            int high = std::max(p1, p2);
+            int low = std::min(p1, p2);
+            int p_high = comp[high].load(std::memory_order_relaxed);
+            if (p_high == low) break;
+            if (p_high == high && comp[high].compare_exchange_strong(p_high, low, std::memory_order_acq_rel)) break;
+            p1 = comp[comp[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+            p2 = comp[low].load(std::memory_order_relaxed);
+        }
+    }
+
+    void compress(vector<std::atomic<int>>& comp, ThreadPool& pool) {
+        pool.parallelFor(0, num_nodes, 1024, [&](int, size_t lo, size_t hi) {
+            for (size_t v = lo; v < hi; ++v) {
+                while (true) {
+                    int p = comp[v].load(std::memory_order_relaxed);
+                    int gp = comp[p].load(std::memory_order_relaxed);
+                    if (p == gp) break;
+                    comp[v].store(gp, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    int sampleFrequentComponent(vector<std::atomic<int>>& comp) {
+        std::mt19937 gen(27491095);
+        std::uniform_int_distribution<int> pick(0, num_nodes - 1);
+        std::unordered_map<int, int> counts;
+        for (int i = 0; i < CC_SAMPLE_NUM; ++i) ++counts[comp[pick(gen)].load(std::memory_order_relaxed)];
+        int best = 0, best_count = -1;
+        for (const auto &c : counts) {
+            if (c.second > best_count) {
+                best = c.first;
+                best_count = c.second;
+            }
+        }
+        return best;
+    }
+
+public:
+    CCPar(int max_threads = 0) : num_nodes(0), edge_count(0), max_threads(max_threads) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // CSR shared through the store (mapped from the graph cache when there is one)
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        graph = store.csr();
+    }
+
+    Components components(ThreadPool& pool) {
+        vector<std::atomic<int>> comp(num_nodes);
+        for (int v = 0; v < num_nodes; ++v) comp[v].store(v, std::memory_order_relaxed);
+
+        for (int r = 0; r < CC_NEIGHBOR_ROUNDS; ++r) {
+            pool.parallelFor(0, num_nodes, 1024, [&](int, size_t lo, size_t hi) {
+                for (size_t u = lo; u < hi; ++u) {
+                    if (graph.degree(u) > r) link(comp, u, graph.begin(u)[r]);
+                }
+            });
+            compress(comp, pool);
+        }
+
+        const int giant = num_nodes ? sampleFrequentComponent(comp) : 0;
+        pool.parallelFor(0, num_nodes, 256, [&](int, size_t lo, size_t hi) {
+            for (size_t u = lo; u < hi; ++u) {
+                if (comp[u].load(std::memory_order_relaxed) == giant) continue;
+                for (const int *it = graph.begin(u) + std::min(graph.degree(u), CC_NEIGHBOR_ROUNDS), *end = graph.end(u); it != end; ++it) {
+                    link(comp, u, *it);
+                }
+            }
+        });
+        compress(comp, pool);
+
+        // Roots renumbered in order of their smallest vertex
+        Components result;
+        result.id.resize(num_nodes);
+        for (int v = 0; v < num_nodes; ++v) result.id[v] = comp[v].load(std::memory_order_relaxed);
+        result.normalize(num_nodes);
+        return result;
+    }
+
+    // Bileşenleri 1..N thread ile hesapla
+    void compute(const std::string& output_filename, int iterations = 10) {
+        vector<int> steps = scalingSteps(max_threads);
+        vector<double> averages;
+        size_t component_num = 0;
+
+        for (int thread_num : steps) {
+            ThreadPool pool(thread_num);
+            double total_time = 0.0;
+            for (int i = 0; i < iterations; i++) {
+                auto start_time = std::chrono::high_resolution_clock::now();
+                Components result = components(pool);
+                auto end_time = std::chrono::high_resolution_clock::now();
+                total_time += std::chrono::duration<double>(end_time - start_time).count();
+
+                if (i == 0 && averages.empty()) {
+                    result.write(output_filename);
+                    component_num = result.sizes.size();
+                }
+            }
+            averages.push_back(total_time / iterations);
+        }
+
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        for (size_t k = 0; k < steps.size(); ++k) {
+            std::cout << "Afforest CC " << steps[k] << " thread Avarage: " << averages[k]
+                      << " second (" << component_num << " components, speedup "
+                      << averages[0] / averages[k] << "x)\n";
+            file2 << "CC Par x" << steps[k] << " : " << averages[k] << " s" << endl;
+        }
+        file2.close();
+    }
+};
+
+#endif // BFS_COMPONENTS_HPP
@@ -0,0 +1,95 @@
+#ifndef BFS_CSR_HPP
+#define BFS_CSR_HPP
+
+// BFS on compressed sparse row storage
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <memory>
+
+#include "../graphLib/csrGraph.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+class BFSCsr {
+private:
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    CSRView graph;
+    int num_nodes;
+    int edge_count;
+
+public:
+    BFSCsr() : num_nodes(0), edge_count(0) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // CSR shared through the store (mapped from the graph cache when there is one)
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        graph = store.csr();
+    }
+
+    // Frontier kept in a flat array: q[head..tail) is the current queue
+    vector<int> bfs(int start) {
+        vector<int> dist(num_nodes, -1);
+        vector<int> q(num_nodes);
+        int head = 0, tail = 0;
+        dist[start] = 0;
+        q[tail++] = start;
+
+        while (head < tail) {
+            int node = q[head++];
+            const int next_dist = dist[node] + 1;
+            for (const int *it = graph.begin(node), *end = graph.end(node); it != end; ++it) {
+                if (dist[*it] == -1) {
+                    dist[*it] = next_dist;
+                    q[tail++] = *it;
+                }
+            }
+        }
+        return dist;
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        int start_node = 0;
+        double total_time = 0.0;
+
+        for (int i = 0; i < iterations; i++) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            vector<int> distances = bfs(start_node);
+            auto end_time = std::chrono::high_resolution_clock::now();
+            total_time += std::chrono::duration<double>(end_time - start_time).count();
+
+            if (i == 0) {
+                writeResultArray(file, output_filename, ResultKind::Distance, start_node, distances);
+            }
+        }
+
+        double avg = total_time / iterations;
+        std::cout << "CSR Avarage: " << avg << " second (" << graph.memoryBytes()
+                  << " bytes, adj list >= " << graph.adjListMemoryBytes() << " bytes)\n";
+        file.close();
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "CSR : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif // BFS_CSR_HPP
@@ -6,14 +6,18 @@
 #include <vector>
 #include <queue>
 #include <fstream>
-#include <sstream>
 #include <chrono>
+#include <memory>
+
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
  
 using namespace std;
 
 class BFSCstm {
 private:
-    vector<vector<int>> adjList;
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    const GraphStore::AdjacencyList *graph = nullptr;
     int num_nodes;
     int edge_count;
 
@@ -22,32 +26,15 @@ public:
 
     // Grafiği dosyadan oku
     void readGraphFromFile(const std::string& filename) {
-        std::ifstream file(filename);
-        if (!file.is_open()) {
-            std::cerr << "Dosya açılamadı: " << filename << std::endl;
-            exit(1);
-        }
-        
-        std::string line;
-        while (std::getline(file, line)) {
-            if (line[0] == 'c') continue; // Yorum satırlarını atla
-            if (line[0] == 'p') {
-                std::stringstream ss(line);
-                std::string tmp;
-                ss >> tmp >> tmp >> num_nodes >> edge_count;
-                adjList.resize(num_nodes);
-            } else if (line[0] == 'a') {
-                std::stringstream ss(line);
-                char a;
-                int u, v;
-                ss >> a >> u >> v;
-                --u;
-                --v;
-                adjList[u].push_back(v);
-                adjList[v].push_back(u);  
-            }
-        }
-        file.close();
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Adjacency list shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        graph = &store.adjacencyList();
     }
 
     // BFS implementasyonu
@@ -60,7 +47,7 @@ public:
         while (!q.empty()) {
             int node = q.front();
             q.pop();
-            for (int neighbor : adjList[node]) {
+            for (int neighbor : (*graph)[node]) {
                 if (dist[neighbor] == -1) {
                     dist[neighbor] = dist[node] + 1;
                     q.push(neighbor);
@@ -72,7 +59,7 @@ public:
 
     // BFS'leri test et
     void compute(const std::string& output_filename, int iterations = 10) {
-        ofstream file(output_filename);
+        ResultWriter file(output_filename);
         if (!file.is_open()) {
             cerr << "File couldnt oppen!" << endl;
             return;
@@ -91,12 +78,7 @@ public:
             
             // Sadece ilk çalıştırmada dosyaya yaz
             if (i == 0) {
-                for (int j = 0; j < num_nodes; j++) {
-                    if (j != start_node) {
-                        file << "Node " << start_node << " -> " << j
-                        << " shortest distance: " << distances[j] << "\n";
-                    } 
-                }
+                writeResultArray(file, output_filename, ResultKind::Distance, start_node, distances);
                 file.close();
             }
         }
@@ -0,0 +1,168 @@
+#ifndef BFS_DELTA_STEP_HPP
+#define BFS_DELTA_STEP_HPP
+
+// Multithreaded weighted shortest paths with delta-stepping
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <memory>
+#include <atomic>
+#include <limits>
+#include <cstdint>
+
+#include "../graphLib/weightedCsr.hpp"
+#include "../graphLib/threadPool.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+// Bucket vertices handed to a thread at once
+#define DELTA_GRAIN 64
+
+using namespace std;
+
+// Vertices are kept in buckets of width delta by tentative distance. The
+// lowest non-empty bucket is relaxed in parallel, all arcs of its
+// vertices at once, and the bucket is drained again until no relaxation
+// lands in it. Distances are lowered with a CAS loop; the thread that
+// lowers one files the vertex in its local bins, which are merged into
+// the shared buckets after every step. Entries whose distance has since
+// moved to another bucket are skipped.
+class BFSDeltaStep {
+private:
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    const WeightedCSRGraph *graph = nullptr; // shared through the store
+    int num_nodes;
+    int edge_count;
+    int max_threads;
+    int64_t delta;      // 0 = average arc weight
+
+public:
+    BFSDeltaStep(int max_threads = 0, int64_t delta = 0)
+        : num_nodes(0), edge_count(0), max_threads(max_threads), delta(delta) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Weighted CSR shared through the store, mapped from the cache if fresh
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        graph = &store.weightedCsr();
+    }
+
+    int64_t bucketWidth() const {
+        if (delta > 0) return delta;
+        if (graph->arcCount() == 0) return 1;
+        return std::max<int64_t>(1, 2 * graph->total_weight / (int64_t)graph->arcCount());
+    }
+
+    // dist[v] = weight of the shortest path from start, -1 if unreachable
+    vector<int64_t> deltaStepping(int start, ThreadPool& pool) {
+        const int64_t INF = std::numeric_limits<int64_t>::max();
+        const int64_t width = bucketWidth();
+        const int thread_num = pool.size();
+
+        vector<std::atomic<int64_t>> dist(num_nodes);
+        for (auto &d : dist) d.store(INF, std::memory_order_relaxed);
+        dist[start].store(0, std::memory_order_relaxed);
+
+        vector<vector<int>> buckets(1, vector<int>{start});
+        vector<vector<vector<int>>> localBins(thread_num);
+        vector<int> frontier;
+
+        for (size_t b = 0; b < buckets.size(); ++b) {
+            while (!buckets[b].empty()) {
+                frontier.swap(buckets[b]);
+                buckets[b].clear();
+
+                pool.parallelFor(0, frontier.size(), DELTA_GRAIN, [&](int tid, size_t lo, size_t hi) {
+                    auto &bins = localBins[tid];
+                    for (size_t i = lo; i < hi; ++i) {
+                        const int u = frontier[i];
+                        const int64_t du = dist[u].load(std::memory_order_relaxed);
+                        if ((size_t)(du / width) != b) continue; // stale entry
+                        for (const WeightedArc *it = graph->begin(u), *end = graph->end(u); it != end; ++it) {
+                            const int64_t nd = du + it->w;
+                            int64_t current = dist[it->v].load(std::memory_order_relaxed);
+                            while (nd < current) {
+                                if (dist[it->v].compare_exchange_weak(current, nd, std::memory_order_relaxed)) {
+                                    const size_t nb = nd / width;
+                                    if (nb >= bins.size()) bins.resize(nb + 1);
+                                    bins[nb].push_back(it->v);
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                });
+
+                for (auto &bins : localBins) {
+                    if (bins.size() > buckets.size()) buckets.resize(bins.size());
+                    for (size_t nb = b; nb < bins.size(); ++nb) {
+                        buckets[nb].insert(buckets[nb].end(), bins[nb].begin(), bins[nb].end());
+                        bins[nb].clear();
+                    }
+                }
+            }
+        }
+
+        vector<int64_t> result(num_nodes);
+        for (int v = 0; v < num_nodes; ++v) {
+            const int64_t d = dist[v].load(std::memory_order_relaxed);
+            result[v] = d == INF ? -1 : d;
+        }
+        return result;
+    }
+
+    // Delta-stepping'i 1..N thread ile test et
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        int start_node = 0;
+        vector<int> steps = scalingSteps(max_threads);
+        vector<double> averages;
+
+        for (int thread_num : steps) {
+            ThreadPool pool(thread_num);
+            double total_time = 0.0;
+            for (int i = 0; i < iterations; i++) {
+                auto start_time = std::chrono::high_resolution_clock::now();
+                vector<int64_t> distances = deltaStepping(start_node, pool);
+                auto end_time = std::chrono::high_resolution_clock::now();
+                total_time += std::chrono::duration<double>(end_time - start_time).count();
+
+                if (i == 0 && averages.empty()) {
+                    for (int j = 0; j < num_nodes; j++) {
+                        if (j != start_node) {
+                            file << "Node " << start_node << " -> " << j
+                                 << " shortest distance: " << distances[j] << "\n";
+                        }
+                    }
+                }
+            }
+            averages.push_back(total_time / iterations);
+        }
+        file.close();
+
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        for (size_t k = 0; k < steps.size(); ++k) {
+            std::cout << "Delta-stepping " << steps[k] << " thread Avarage: " << averages[k]
+                      << " second (delta " << bucketWidth() << ", speedup " << averages[0] / averages[k] << "x)\n";
+            file2 << "Delta x" << steps[k] << " : " << averages[k] << " s" << endl;
+        }
+        file2.close();
+    }
+};
+
+#endif // BFS_DELTA_STEP_HPP
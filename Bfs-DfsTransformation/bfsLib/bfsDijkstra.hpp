@@ -0,0 +1,105 @@
+#ifndef BFS_DIJKSTRA_HPP
+#define BFS_DIJKSTRA_HPP
+
+// Weighted shortest paths (DIMACS arc weights) with Dijkstra on a 4-ary heap
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <memory>
+#include <cstdint>
+
+#include "../graphLib/weightedCsr.hpp"
+#include "../graphLib/quadHeap.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+class BFSDijkstra {
+private:
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    const WeightedCSRGraph *graph = nullptr; // shared through the store
+    QuadHeap heap;
+    int num_nodes;
+    int edge_count;
+
+public:
+    BFSDijkstra() : num_nodes(0), edge_count(0) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Weighted CSR shared through the store, mapped from the cache if fresh
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        graph = &store.weightedCsr();
+    }
+
+    // dist[v] = weight of the shortest path from start, -1 if unreachable
+    vector<int64_t> dijkstra(int start) {
+        vector<int64_t> dist(num_nodes, -1);
+        vector<char> settled(num_nodes, 0);
+        heap.reset(num_nodes);
+        dist[start] = 0;
+        heap.push(start, 0);
+
+        while (!heap.empty()) {
+            const int u = heap.pop();
+            settled[u] = 1;
+            const int64_t du = dist[u];
+            for (const WeightedArc *it = graph->begin(u), *end = graph->end(u); it != end; ++it) {
+                if (settled[it->v]) continue;
+                const int64_t nd = du + it->w;
+                if (dist[it->v] < 0 || nd < dist[it->v]) {
+                    dist[it->v] = nd;
+                    heap.push(it->v, nd);
+                }
+            }
+        }
+        return dist;
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        int start_node = 0;
+        double total_time = 0.0;
+
+        for (int i = 0; i < iterations; i++) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            vector<int64_t> distances = dijkstra(start_node);
+            auto end_time = std::chrono::high_resolution_clock::now();
+            total_time += std::chrono::duration<double>(end_time - start_time).count();
+
+            if (i == 0) {
+                for (int j = 0; j < num_nodes; j++) {
+                    if (j != start_node) {
+                        file << "Node " << start_node << " -> " << j
+                             << " shortest distance: " << distances[j] << "\n";
+                    }
+                }
+            }
+        }
+
+        double avg = total_time / iterations;
+        std::cout << "Dijkstra Avarage: " << avg << " second\n";
+        file.close();
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "Dijkstra : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif // BFS_DIJKSTRA_HPP
@@ -0,0 +1,119 @@
+#ifndef BFS_HYBRID_HPP
+#define BFS_HYBRID_HPP
+
+// BFS over HybridAdjacency: dense rows are expanded word by word against
+// the visited bitset, sparse rows by walking their sorted neighbour array
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <memory>
+#include <cstdint>
+
+#include "../graphLib/hybridAdjacency.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+class BFSHybrid {
+private:
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    HybridAdjacency graph;
+    int num_nodes;
+    int edge_count;
+    int degree_threshold; // 0 = HybridAdjacency default
+
+public:
+    BFSHybrid(int threshold = 0) : num_nodes(0), edge_count(0), degree_threshold(threshold) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Built from the store's edge list, parsed once for all engines
+    void readGraph(GraphStore& store) { readEdges(store.edges()); }
+
+    void readEdges(const EdgeSpan& stream) {
+        num_nodes = stream.num_nodes;
+        edge_count = stream.edge_count;
+        graph.build(stream, degree_threshold);
+    }
+
+    vector<int> bfs(int start) {
+        vector<int> dist(num_nodes, -1);
+        vector<int> q(num_nodes);
+        vector<uint64_t> visited(graph.blocksPerRow(), 0);
+        const size_t blocks = graph.blocksPerRow();
+        int head = 0, tail = 0;
+
+        dist[start] = 0;
+        Block64::set(visited.data(), start);
+        q[tail++] = start;
+
+        while (head < tail) {
+            int node = q[head++];
+            const int next_dist = dist[node] + 1;
+            if (graph.isDense(node)) {
+                const uint64_t *row = graph.denseRow(node);
+                for (size_t b = 0; b < blocks; ++b) {
+                    uint64_t bits = row[b] & ~visited[b];
+                    if (!bits) continue;
+                    visited[b] |= bits;
+                    while (bits) {
+                        int v = b * 64 + __builtin_ctzll(bits);
+                        dist[v] = next_dist;
+                        q[tail++] = v;
+                        bits &= bits - 1;
+                    }
+                }
+            } else {
+                for (const int *it = graph.sparseBegin(node), *end = graph.sparseEnd(node); it != end; ++it) {
+                    if (!Block64::test(visited.data(), *it)) {
+                        Block64::set(visited.data(), *it);
+                        dist[*it] = next_dist;
+                        q[tail++] = *it;
+                    }
+                }
+            }
+        }
+        return dist;
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        int start_node = 0;
+        double total_time = 0.0;
+
+        for (int i = 0; i < iterations; i++) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            vector<int> distances = bfs(start_node);
+            auto end_time = std::chrono::high_resolution_clock::now();
+            total_time += std::chrono::duration<double>(end_time - start_time).count();
+
+            if (i == 0) {
+                writeResultArray(file, output_filename, ResultKind::Distance, start_node, distances);
+            }
+        }
+
+        double avg = total_time / iterations;
+        std::cout << "Hybrid Avarage: " << avg << " second (" << graph.denseCount() << "/" << num_nodes
+                  << " dense rows, degree >= " << graph.threshold() << ", " << graph.memoryBytes() << " bytes)\n";
+        file.close();
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "Hybrid : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif // BFS_HYBRID_HPP
@@ -0,0 +1,196 @@
+#ifndef BFS_MULTI_SOURCE_HPP
+#define BFS_MULTI_SOURCE_HPP
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <algorithm>
+#include <memory>
+
+#include "../graphLib/bitMatrix.hpp"
+#include "../graphLib/compactDistances.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+// One bit per source: a pass runs up to 64 BFS traversals at once
+#define LANE_NUM 64
+
+using namespace std;
+
+// Bit-parallel multi-source BFS over the bitwise adjacency matrix.
+// Every vertex keeps a "seen" and a "visit" word whose bit i belongs to
+// source i of the current batch, so one scan of the adjacency rows
+// advances all traversals of the batch by one level.
+class BFSMultiSource {
+public:
+    // Called once per source with its full distance row (-1 = unreachable)
+    using DistanceCallback = std::function<void(int source, const std::vector<int>& dist)>;
+
+private:
+    int num_nodes;
+    int edge_count;
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    BitMatrix<Block64> edges;
+
+    // Runs one batch of at most LANE_NUM sources, dist[i] belongs to sources[i]
+    void bfs_batch(const int *sources, int lane_count, std::vector<std::vector<int>>& dist) {
+        std::vector<uint64_t> seen(num_nodes, 0), visit(num_nodes, 0), next(num_nodes, 0);
+
+        for (int i = 0; i < lane_count; ++i) {
+            dist[i].assign(num_nodes, -1);
+            dist[i][sources[i]] = 0;
+            seen[sources[i]] |= (uint64_t)1 << i;
+            visit[sources[i]] |= (uint64_t)1 << i;
+        }
+
+        const size_t block_num = Block64::blockCount(num_nodes);
+        bool active = true;
+        for (int level = 1; active; ++level) {
+            // Push the lanes of every visited vertex to its neighbours
+            for (int u = 0; u < num_nodes; ++u) {
+                uint64_t lanes = visit[u];
+                if (!lanes) continue;
+                const uint64_t *row = edges.row(u);
+                for (size_t block_index = 0; block_index < block_num; ++block_index) {
+                    uint64_t bits = row[block_index];
+                    while (bits) {
+                        int v = block_index * 64 + __builtin_ctzll(bits);
+                        next[v] |= lanes;
+                        bits &= bits - 1;
+                    }
+                }
+            }
+
+            active = false;
+            for (int v = 0; v < num_nodes; ++v) {
+                uint64_t fresh = next[v] & ~seen[v];
+                next[v] = 0;
+                visit[v] = fresh;
+                if (!fresh) continue;
+                active = true;
+                seen[v] |= fresh;
+                while (fresh) {
+                    dist[__builtin_ctzll(fresh)][v] = level;
+                    fresh &= fresh - 1;
+                }
+            }
+        }
+    }
+
+public:
+    BFSMultiSource() : num_nodes(0), edge_count(0) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Bit-matrix rows shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        edges = store.bitMatrix<Block64>();
+    }
+
+    int nodeCount() const { return num_nodes; }
+
+    // Streams the distance row of every source, LANE_NUM sources per pass
+    void bfs_multi_source(const std::vector<int>& sources, const DistanceCallback& callback) {
+        std::vector<std::vector<int>> dist(LANE_NUM);
+        for (size_t first = 0; first < sources.size(); first += LANE_NUM) {
+            int lane_count = (int)std::min<size_t>(LANE_NUM, sources.size() - first);
+            bfs_batch(&sources[first], lane_count, dist);
+            for (int i = 0; i < lane_count; ++i) {
+                callback(sources[first + i], dist[i]);
+            }
+        }
+    }
+
+    // source x vertex distance table, row i belongs to sources[i]
+    std::vector<std::vector<int>> distance_table(const std::vector<int>& sources) {
+        std::vector<std::vector<int>> table;
+        table.reserve(sources.size());
+        bfs_multi_source(sources, [&](int, const std::vector<int>& dist) {
+            table.push_back(dist);
+        });
+        return table;
+    }
+
+    // Same table in a compact form, Table = PackedDistances<uint8_t / uint16_t>
+    // or LevelDistances<>: 4x / 2x / 32 / levels smaller than vector<int> rows
+    template <typename Table>
+    std::vector<Table> compact_distance_table(const std::vector<int>& sources) {
+        std::vector<Table> table(sources.size());
+        size_t row = 0;
+        bfs_multi_source(sources, [&](int, const std::vector<int>& dist) {
+            table[row++].assign(dist);
+        });
+        return table;
+    }
+
+    // All-sources BFS, writes eccentricity and closeness of every vertex
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            std::cerr << "Sonuç dosyası açılamadı!" << std::endl;
+            return;
+        }
+
+        std::vector<int> sources(num_nodes);
+        for (int v = 0; v < num_nodes; ++v) sources[v] = v;
+        std::vector<int> eccentricity(num_nodes, 0);
+        std::vector<double> closeness(num_nodes, 0.0);
+
+        double total_time = 0.0;
+        for (int i = 0; i < iterations; i++) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            bfs_multi_source(sources, [&](int source, const std::vector<int>& dist) {
+                int ecc = 0, reached = 0;
+                long long sum = 0;
+                for (int d : dist) {
+                    if (d <= 0) continue;
+                    if (d > ecc) ecc = d;
+                    sum += d;
+                    ++reached;
+                }
+                eccentricity[source] = ecc;
+                closeness[source] = sum ? (double)reached / sum : 0.0;
+            });
+            auto end_time = std::chrono::high_resolution_clock::now();
+            total_time += std::chrono::duration<double>(end_time - start_time).count();
+
+            if (i == 0) {
+                for (int v = 0; v < num_nodes; ++v) {
+                    file << "Node " << v << " eccentricity: " << eccentricity[v]
+                         << " closeness: " << closeness[v] << "\n";
+                }
+            }
+        }
+
+        double avg = total_time / iterations;
+        std::cout << "BTW MS all-sources Avarage: " << avg << " second ("
+                  << (num_nodes + LANE_NUM - 1) / LANE_NUM << " passes)\n";
+
+        // Size of the all-sources table in each form, built once untimed
+        size_t packed_bytes = 0, level_bytes = 0;
+        for (const auto &row : compact_distance_table<PackedDistances<uint8_t>>(sources)) packed_bytes += row.bytes();
+        for (const auto &row : compact_distance_table<LevelDistances<>>(sources)) level_bytes += row.bytes();
+        const size_t int_bytes = (size_t)num_nodes * num_nodes * sizeof(int);
+        std::cout << "Distance table: " << int_bytes << " bytes int, " << packed_bytes << " bytes uint8 ("
+                  << (double)int_bytes / std::max<size_t>(1, packed_bytes) << "x), " << level_bytes
+                  << " bytes level bitsets (" << (double)int_bytes / std::max<size_t>(1, level_bytes) << "x)\n";
+        file.close();
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "Btw MS all-src : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif // BFS_MULTI_SOURCE_HPP
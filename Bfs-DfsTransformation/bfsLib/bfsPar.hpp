@@ -0,0 +1,136 @@
+#ifndef BFS_PARALLEL_HPP
+#define BFS_PARALLEL_HPP
+
+// Level-synchronous multithreaded BFS implementation
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+
+#include "../graphLib/threadPool.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+// Frontier vertices handed to a thread at once
+#define PAR_GRAIN 64
+
+using namespace std;
+
+class BFSPar {
+private:
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    const GraphStore::AdjacencyList *graph = nullptr;
+    int num_nodes;
+    int edge_count;
+    int max_threads;
+
+public:
+    BFSPar(int max_threads = 0) : num_nodes(0), edge_count(0), max_threads(max_threads) {}
+
+    // Grafiği dosyadan oku
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Adjacency list shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        graph = &store.adjacencyList();
+    }
+
+    // Every level is split across the pool. A vertex belongs to the thread
+    // whose fetch_or set its visited bit first; that thread writes its
+    // distance and appends it to its local next-frontier buffer.
+    vector<int> bfs(int start, ThreadPool& pool) {
+        vector<int> dist(num_nodes, -1);
+        const size_t block_num = (num_nodes + 63) / 64;
+        vector<std::atomic<uint64_t>> visited(block_num);
+        for (auto &block : visited) block.store(0, std::memory_order_relaxed);
+
+        const int thread_num = pool.size();
+        vector<vector<int>> localNext(thread_num);
+        vector<size_t> offsets(thread_num + 1, 0);
+        vector<int> frontier, next;
+
+        dist[start] = 0;
+        visited[start / 64].store((uint64_t)1 << (start % 64), std::memory_order_relaxed);
+        frontier.push_back(start);
+
+        for (int level = 1; !frontier.empty(); ++level) {
+            pool.parallelFor(0, frontier.size(), PAR_GRAIN, [&](int tid, size_t lo, size_t hi) {
+                auto &out = localNext[tid];
+                for (size_t i = lo; i < hi; ++i) {
+                    for (int neighbor : (*graph)[frontier[i]]) {
+                        const uint64_t mask = (uint64_t)1 << (neighbor % 64);
+                        auto &block = visited[neighbor / 64];
+                        if (block.load(std::memory_order_relaxed) & mask) continue;
+                        if (block.fetch_or(mask, std::memory_order_relaxed) & mask) continue;
+                        dist[neighbor] = level;
+                        out.push_back(neighbor);
+                    }
+                }
+            });
+
+            // Local buffers are copied side by side into the next frontier
+            for (int t = 0; t < thread_num; ++t) {
+                offsets[t + 1] = offsets[t] + localNext[t].size();
+            }
+            next.resize(offsets[thread_num]);
+            pool.run([&](int tid) {
+                std::copy(localNext[tid].begin(), localNext[tid].end(), next.begin() + offsets[tid]);
+                localNext[tid].clear();
+            });
+            frontier.swap(next);
+        }
+        return dist;
+    }
+
+    // BFS'leri 1..N thread ile test et
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        int start_node = 0;
+        vector<int> steps = scalingSteps(max_threads);
+        vector<double> averages;
+
+        for (int thread_num : steps) {
+            ThreadPool pool(thread_num);
+            double total_time = 0.0;
+            for (int i = 0; i < iterations; i++) {
+                auto start_time = std::chrono::high_resolution_clock::now();
+                vector<int> distances = bfs(start_node, pool);
+                auto end_time = std::chrono::high_resolution_clock::now();
+                total_time += std::chrono::duration<double>(end_time - start_time).count();
+
+                if (i == 0 && averages.empty()) {
+                    writeResultArray(file, output_filename, ResultKind::Distance, start_node, distances);
+                }
+            }
+            averages.push_back(total_time / iterations);
+        }
+        file.close();
+
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        for (size_t k = 0; k < steps.size(); ++k) {
+            std::cout << "Parallel " << steps[k] << " thread Avarage: " << averages[k]
+                      << " second (speedup " << averages[0] / averages[k] << "x)\n";
+            file2 << "Par x" << steps[k] << " : " << averages[k] << " s" << endl;
+        }
+        file2.close();
+    }
+};
+
+#endif // BFS_PARALLEL_HPP
@@ -0,0 +1,87 @@
+#ifndef BFS_REACH_HPP
+#define BFS_REACH_HPP
+
+// Reachability queries answered from a transitive closure instead of a traversal per query
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <random>
+#include <memory>
+
+#include "../graphLib/transitiveClosure.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+// Random (s, t) pairs timed per compute() call
+#define REACH_QUERY_NUM 100000
+
+using namespace std;
+
+class BFSReach {
+private:
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    EdgeSpan stream; // the store's arcs, not copied
+    ReachabilityIndex index;
+    bool directed;
+    int max_threads;
+
+public:
+    BFSReach(bool directed = true, int max_threads = 0) : directed(directed), max_threads(max_threads) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    void readGraph(GraphStore& store) { stream = store.edges(); }
+
+    const ReachabilityIndex& reachabilityIndex() const { return index; }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        ThreadPool pool(max_threads);
+        double build_time = 0.0;
+        for (int i = 0; i < iterations; i++) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            index.build(stream, directed, pool);
+            auto end_time = std::chrono::high_resolution_clock::now();
+            build_time += std::chrono::duration<double>(end_time - start_time).count();
+        }
+
+        const int num_nodes = index.nodeCount();
+        for (int j = 1; j < num_nodes; j++) {
+            file << "Node 0 -> " << j << " reachable: " << index.reachable(0, j) << "\n";
+        }
+        file.close();
+
+        vector<pair<int, int>> queries(num_nodes ? REACH_QUERY_NUM : 0);
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> pick(0, num_nodes - 1);
+        for (auto &q : queries) q = {pick(gen), pick(gen)};
+        vector<char> answers;
+        auto start_time = std::chrono::high_resolution_clock::now();
+        index.reachableBatch(queries, answers);
+        auto end_time = std::chrono::high_resolution_clock::now();
+        double query_time = std::chrono::duration<double>(end_time - start_time).count() / REACH_QUERY_NUM;
+
+        double avg = build_time / iterations;
+        std::cout << "BTW Closure Avarage: " << avg << " second (" << pool.size() << " threads, "
+                  << index.memoryBytes() << " bytes), query: " << query_time << " second\n";
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "Btw Closure : " << avg << " s" << endl;
+        file2 << "Reach Query : " << query_time << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif // BFS_REACH_HPP
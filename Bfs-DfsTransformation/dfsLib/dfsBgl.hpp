@@ -3,58 +3,45 @@
 
 #include <iostream>
 #include <fstream>
-#include <sstream>
 #include <vector>
 #include <stack>
 #include <chrono>
+#include <memory>
 #include <numeric>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/depth_first_search.hpp>
 
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
 using namespace std;
 using namespace boost;
 
 class DFSBgl {
 private:
-    typedef adjacency_list<vecS, vecS, undirectedS> Graph;
-    Graph g;
+    typedef GraphStore::BoostGraph Graph;
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    const Graph *g;
     int num_nodes;
     int edge_count;
 
 public:
-    DFSBgl() : num_nodes(0), edge_count(0) {}
+    DFSBgl() : g(nullptr), num_nodes(0), edge_count(0) {}
 
     void readGraphFromFile(const std::string& filename) {
-        std::ifstream file(filename);
-        if (!file.is_open()) {
-            std::cerr << "Dosya açılamadı: " << filename << std::endl;
-            exit(1);
-        }
-        
-        std::string line;
-        while (std::getline(file, line)) {
-            if (line[0] == 'c') continue; // Yorum satırlarını atla
-            if (line[0] == 'p') {
-                std::stringstream ss(line);
-                std::string tmp;
-                ss >> tmp >> tmp >> num_nodes >> edge_count;
-                // Graph'ı baştan oluşturmak
-                g = Graph(num_nodes);
-            } else if (line[0] == 'a') {
-                std::stringstream ss(line);
-                char a;
-                int u, v;
-                ss >> a >> u >> v;
-                --u;
-                --v;
-                add_edge(u, v, g);  // Kenar ekle
-            }
-        }
-        file.close();
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Graph'ı store'dan al, diğer motorlarla ortak
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        g = &store.boostGraph();
     }
 
     void compute(const std::string& output_filename, int iterations = 10) {
-        ofstream file(output_filename);
+        ResultWriter file(output_filename);
         if (!file.is_open()) {
             cerr << "File couldn't open!" << endl;
             return;
@@ -85,7 +72,7 @@ public:
                 }
 
                 graph_traits<Graph>::adjacency_iterator adj, adj_end;
-                for (tie(adj, adj_end) = adjacent_vertices(u, g); adj != adj_end; ++adj) {
+                for (tie(adj, adj_end) = adjacent_vertices(u, *g); adj != adj_end; ++adj) {
                     int v = *adj;
                     if (!visited[v]) {
                         s.push(v);
@@ -98,10 +85,7 @@ public:
             durations.push_back(duration);
 
             if (it == 0) { 
-                for (int j = 1; j < nodePos.size(); ++j) {
-                    file << "Node 0 " << " -> " << j
-                         << " Shortest path: " << nodePos[j] << "\n";
-                }
+                writeResultArray(file, output_filename, ResultKind::VisitOrder, 0, nodePos);
                 file.close();
             }
         }
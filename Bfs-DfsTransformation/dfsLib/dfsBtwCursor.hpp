@@ -0,0 +1,135 @@
+#ifndef DFS__BTW__CURSOR__HPP
+#define DFS__BTW__CURSOR__HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <numeric>
+#include <string>
+#include <memory>
+
+#include "../graphLib/bitMatrix.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+// Bitwise DFS with one stack frame per vertex on the current path. A frame
+// keeps the block where the scan of its row stopped; the next child is the
+// lowest bit of row[b] & ~visited[b], so nothing is ever pushed twice and
+// the stack never holds more than num_nodes frames. Every row is scanned
+// once in total: O(V * N / bits) word operations.
+template <typename Block = Block64>
+class DFSBtwCursorT {
+public:
+    using block_t = typename Block::type;
+
+private:
+    struct Frame {
+        int vertex;
+        int block; // first block of the row not yet known to be exhausted
+    };
+
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    BitMatrix<Block> adjMatrix;
+    int num_nodes;
+    int edge_count;
+    vector<Frame> s;     // reused between calls
+    size_t max_depth;    // deepest stack seen by the last dfs call
+
+public:
+    DFSBtwCursorT() : num_nodes(0), edge_count(0), max_depth(0) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Bit-matrix rows shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        adjMatrix = store.bitMatrix<Block>();
+        s.reserve(num_nodes);
+    }
+
+    // Recursive DFS preorder (lowest numbered child first),
+    // nodePos[v] = visit order of v (1 based, -1 unreached)
+    void dfs(int start_node, vector<int>& nodePos) {
+        const int block_num = (int)Block::blockCount(num_nodes);
+        vector<block_t> visited(block_num, Block::zero());
+        nodePos.assign(num_nodes, -1);
+        int counter = 0;
+
+        s.clear();
+        Block::set(visited.data(), start_node);
+        nodePos[start_node] = ++counter;
+        s.push_back({start_node, 0});
+        max_depth = 1;
+
+        while (!s.empty()) {
+            Frame &top = s.back();
+            const block_t *row = adjMatrix.row(top.vertex);
+
+            int child = -1;
+            for (; top.block < block_num; ++top.block) {
+                block_t bits = row[top.block] & ~visited[top.block];
+                if (Block::any(bits)) {
+                    child = top.block * Block::bits + Block::ctz(bits);
+                    break;
+                }
+            }
+
+            if (child < 0) { // row exhausted, backtrack
+                s.pop_back();
+                continue;
+            }
+
+            Block::set(visited.data(), child);
+            nodePos[child] = ++counter;
+            s.push_back({child, 0}); // top is invalid from here on
+            if (s.size() > max_depth) max_depth = s.size();
+        }
+    }
+
+    size_t maxDepth() const { return max_depth; }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        std::vector<double> durations;
+        vector<int> nodePos;
+
+        for (int it = 0; it < iterations; ++it) {
+            auto start = std::chrono::high_resolution_clock::now();
+            dfs(0, nodePos); // 0'dan başla
+            auto end = std::chrono::high_resolution_clock::now();
+            durations.push_back(std::chrono::duration<double>(end - start).count());
+
+            if (it == 0) {
+                writeResultArray(file, output_filename, ResultKind::VisitOrder, 0, nodePos);
+                file.close();
+            }
+        }
+
+        double avg = std::accumulate(durations.begin(), durations.end(), 0.0) / iterations;
+        std::cout << "cursor btw Ortalama süre: " << avg << " s" << std::endl;
+        std::cout << "Max stack size: " << max_depth << std::endl;
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "Btw Cursor : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+using DFSBtwCursor = DFSBtwCursorT<Block64>;
+
+#endif
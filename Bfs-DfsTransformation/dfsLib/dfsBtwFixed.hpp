@@ -0,0 +1,150 @@
+#ifndef DFS__BTW__FIXED__HPP
+#define DFS__BTW__FIXED__HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <array>
+#include <variant>
+#include <chrono>
+#include <numeric>
+#include <cstdint>
+#include <memory>
+
+#include "dfsBtwTemp.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/sizeBuckets.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+// DFSBtwTemp traversal for graphs of at most W * 64 vertices, with
+// std::array rows, unrolled row loops and a stack-resident visited set.
+template <size_t W>
+class DFSBtwFixed {
+public:
+    using Row = std::array<uint64_t, W>;
+
+private:
+    int num_nodes;
+    vector<Row> adjMatrix;
+    vector<int> s; // reused between calls so no allocation after the first run
+
+public:
+    DFSBtwFixed() : num_nodes(0) {}
+    explicit DFSBtwFixed(const EdgeSpan& stream) : num_nodes(stream.num_nodes), adjMatrix(stream.num_nodes, Row{}) {
+        for (const Edge &e : stream.edges) {
+            adjMatrix[e.u][e.v / 64] |= (uint64_t)1 << (e.v % 64);
+            adjMatrix[e.v][e.u / 64] |= (uint64_t)1 << (e.u % 64);
+        }
+    }
+
+    void dfs(int start_node, vector<int>& nodePos) {
+        Row visited{};
+        nodePos.assign(num_nodes, -1);
+        int counter = 0;
+
+        s.clear();
+        s.push_back(start_node);
+        while (!s.empty()) {
+            int topElement = s.back();
+            s.pop_back();
+
+            const uint64_t mask = (uint64_t)1 << (topElement % 64);
+            if (visited[topElement / 64] & mask) continue;
+            visited[topElement / 64] |= mask;
+            nodePos[topElement] = ++counter;
+
+            const Row &row = adjMatrix[topElement];
+#pragma GCC unroll 16
+            for (size_t block_index = 0; block_index < W; ++block_index) {
+                uint64_t bits = row[block_index] & ~visited[block_index];
+                while (bits) {
+                    s.push_back(block_index * 64 + __builtin_ctzll(bits));
+                    bits &= bits - 1; // deleteLSB
+                }
+            }
+        }
+    }
+};
+
+// Loads the graph into the smallest size bucket that fits; graphs above
+// 1024 vertices fall back to DFSBtwTemp.
+class DFSBtwSmall {
+private:
+    using Engine = std::variant<std::monostate, DFSBtwFixed<1>, DFSBtwFixed<2>, DFSBtwFixed<4>,
+                                DFSBtwFixed<8>, DFSBtwFixed<16>>;
+    Engine engine;
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    DFSBtwTemp fallback;
+    int num_nodes;
+    int edge_count;
+    int bucket; // vertex capacity of the chosen bucket, 0 = fallback
+
+public:
+    DFSBtwSmall() : num_nodes(0), edge_count(0), bucket(0) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Fixed-size engine built from the store's edge list; graphs too big
+    // for it go to the fallback, which shares the store's bit-matrix
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        bool fits = withSizeBucket(num_nodes, [&](auto words) {
+            engine.emplace<DFSBtwFixed<decltype(words)::value>>(store.edges());
+            bucket = decltype(words)::value * 64;
+        });
+        if (!fits) {
+            engine.emplace<std::monostate>();
+            bucket = 0;
+            fallback.readGraph(store);
+        }
+    }
+
+    void dfs(int start_node, vector<int>& nodePos) {
+        std::visit([&](auto &e) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(e)>, std::monostate>) fallback.dfs(start_node, nodePos);
+            else e.dfs(start_node, nodePos);
+        }, engine);
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        std::vector<double> durations;
+        vector<int> nodePos;
+
+        for (int it = 0; it < iterations; ++it) {
+            auto start = std::chrono::high_resolution_clock::now();
+            dfs(0, nodePos); // 0'dan başla
+            auto end = std::chrono::high_resolution_clock::now();
+            durations.push_back(std::chrono::duration<double>(end - start).count());
+
+            if (it == 0) {
+                writeResultArray(file, output_filename, ResultKind::VisitOrder, 0, nodePos);
+                file.close();
+            }
+        }
+
+        double avg = std::accumulate(durations.begin(), durations.end(), 0.0) / iterations;
+        std::cout << "fixed btw (bucket " << (bucket ? std::to_string(bucket) : std::string("fallback"))
+                  << ") Ortalama süre: " << avg << " s" << std::endl;
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "Btw Fixed : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif
@@ -2,67 +2,90 @@
 #define DFS__BTW__TEMP__HPP
 #include <iostream>
 #include <fstream>
-#include <sstream>
 #include <vector>
 #include <stack>
 #include <chrono>
 #include <numeric>
+#include <string>
+#include <memory>
 
-// Bitwise implementation from custom implementation
-#define block_t __uint64_t
-#define BLOCK_INDEX(bit_index) ((bit_index)/(sizeof(block_t)*8))
-#define MASK_INDEX(bit_index) ((bit_index)%(sizeof(block_t)*8))
-#define MASK(bit_index) ((block_t)1 << MASK_INDEX(bit_index))
-#define TOTAL_BLOCK_NUM(vertex_num) (BLOCK_INDEX(vertex_num-1)+1)
-
-#define SET_EDGE(vertex1, vertex2, edges) edges[vertex1][BLOCK_INDEX(vertex2)] |= MASK(vertex2); edges[vertex2][BLOCK_INDEX(vertex1)] |= MASK(vertex1);
-#define CHECK_BIT(arr, index) (arr[BLOCK_INDEX(index)] & MASK(index)) 
-#define SET_TRUE(arr, index) (arr[BLOCK_INDEX(index)] |= MASK(index))
+#include "../graphLib/bitMatrix.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
 
 using namespace std;
 
-class DFSBtwTemp {
+// Bitwise implementation from custom implementation, Block picks the word
+// width of the rows (see graphLib/blockPolicy.hpp)
+template <typename Block = Block64>
+class DFSBtwTempT {
+public:
+    using block_t = typename Block::type;
+
 private:
-    vector<vector<block_t>> adjMatrix;
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    BitMatrix<Block> adjMatrix;
     int num_nodes;
     int edge_count;
+    const bit_kernels *kernels; // row kernels picked for this CPU
 public:
-    DFSBtwTemp() : num_nodes(0), edge_count(0) {}
+    DFSBtwTempT() : num_nodes(0), edge_count(0), kernels(bit_kernels_get()) {}
 
     void readGraphFromFile(const std::string& filename) {
-        std::ifstream file(filename);
-        if (!file.is_open()) {
-            std::cerr << "Dosya açılamadı: " << filename << std::endl;
-            exit(1);
-        }
-        
-        std::string line;
-        while (std::getline(file, line)) {
-            if (line[0] == 'c') continue; // Yorum satırlarını atla
-            if (line[0] == 'p') {
-                std::stringstream ss(line);
-                std::string tmp;
-                ss >> tmp >> tmp >> num_nodes >> edge_count;
-                // Komşuluk matrisini başlangıçta sıfırlarla doldur
-                adjMatrix.resize(num_nodes, std::vector<block_t>(TOTAL_BLOCK_NUM(num_nodes), 0)); // bitwise operations
-                
-            } else if (line[0] == 'a') {
-                std::stringstream ss(line);
-                char a;
-                int u, v;
-                ss >> a >> u >> v;
-                --u;
-                --v;
-                SET_EDGE(u, v, adjMatrix);
-            }
-        }
-        file.close();
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Bit-matrix rows shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        adjMatrix = store.bitMatrix<Block>(); // bitwise matrix
     }
      
 
 
+    // Iterative DFS, nodePos[v] = visit order of v (1 based, -1 unreached)
+    void dfs(int start_node, vector<int>& nodePos) {
+        const size_t block_num = Block::blockCount(num_nodes);
+        vector<block_t> visited(block_num, Block::zero());
+        vector<block_t> unvisited(block_num, Block::zero());
+        nodePos.assign(num_nodes, -1);
+        int counter = 0;
+
+        // DFS iterative with adjacency matrix
+        std::stack<int> s;
+
+        s.push(start_node);
+        while (!s.empty()) {
+            int topElement = s.top();
+            s.pop();
+            
+            if (Block::test(visited.data(), topElement)) continue; 
+            Block::set(visited.data(), topElement); 
+            ++counter;
+            
+            if (nodePos[topElement] == -1) { 
+                nodePos[topElement] = counter;
+            } 
+            
+            // row & ~visited in one kernel call, visited neighbours are never pushed
+            Block::rowAndNotCopy(kernels, unvisited.data(), adjMatrix.row(topElement), visited.data(), block_num);
+            for (size_t block_index = 0; block_index < block_num; ++block_index) {  
+                block_t bits = unvisited[block_index]; // get spesific block
+                while (Block::any(bits)) { // till to 0
+                    int offset = Block::ctz(bits); // get LSB position
+                    int v = block_index * Block::bits + offset; // calculate spesific index
+
+                    s.push(v);
+                    bits = Block::clearLowest(bits); // deleteLSB
+                }
+            }
+        }
+    }
+
     void compute(const std::string& output_filename, int iterations = 10) {
-        ofstream file(output_filename);
+        ResultWriter file(output_filename);
         if (!file.is_open()) {
             cerr << "File couldnt oppen!" << endl;
             return;
@@ -72,62 +95,33 @@ public:
         vector<int> nodePos(num_nodes, -1);
         
         for (int it = 0; it < iterations; ++it) {
-            vector<block_t> visited(TOTAL_BLOCK_NUM(num_nodes), 0);
-            int counter = 0;
             auto start = std::chrono::high_resolution_clock::now();
-            
-            // DFS iterative with adjacency matrix
-            std::stack<int> s;
-
-            s.push(0); // 0'dan başla 
-            while (!s.empty()) {
-                int topElement = s.top();
-                s.pop();
-                
-                if (CHECK_BIT(visited, topElement)) continue; 
-                SET_TRUE(visited, topElement); 
-                ++counter;
-                
-                if (nodePos[topElement] == -1) { 
-                    nodePos[topElement] = counter;
-                } 
-                
-                for (size_t block_index = 0; block_index < TOTAL_BLOCK_NUM(num_nodes); ++block_index) {  
-                    block_t bits = adjMatrix[topElement][block_index]; // get spesific block
-                    while (bits) { // till to 0
-                        int offset = __builtin_ctzll(bits); // get LSB position
-                        int v = (block_index << 6) + offset; // calculate spesific index
-
-                        if (~CHECK_BIT(visited, v)) s.push(v);                        
-                        bits &= bits - 1; // deleteLSB
-                    }
-                }
-
-            }
+            dfs(0, nodePos); // 0'dan başla
             
             auto end = std::chrono::high_resolution_clock::now();
             double duration = std::chrono::duration<double>(end - start).count(); 
             durations.push_back(duration);
 
             if (it == 0) { 
-                for (int j = 1; j < num_nodes; ++j) {
-                    file << "Node 0 " << " -> " << j
-                         << " Shortest path: " << nodePos[j] << "\n";
-                }
+                writeResultArray(file, output_filename, ResultKind::VisitOrder, 0, nodePos);
                 file.close();
             }
         }
         
         double avg = std::accumulate(durations.begin(), durations.end(), 0.0) / iterations;
-        std::cout << "temp btw Ortalama süre: " << avg << " s" << std::endl;
+        std::string label = "Btw";
+        if (Block::bits != 64) label += Block::name;
+        std::cout << "temp " << (label == "Btw" ? "btw" : label) << " Ortalama süre: " << avg << " s" << std::endl;
         ofstream file2("result.txt",  ios::app);
         if (!file2.is_open()) {
             cerr << "File couldn't open!" << endl;
             return;
         }
-        file2 << "Btw : " << avg << " s" << endl;
+        file2 << label << " : " << avg << " s" << endl;
         file2.close();
     }
 };
 
+using DFSBtwTemp = DFSBtwTempT<Block64>;
+
 #endif
@@ -0,0 +1,101 @@
+#ifndef DFS__CSR__HPP
+#define DFS__CSR__HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <stack>
+#include <chrono>
+#include <memory>
+#include <numeric>
+
+#include "../graphLib/csrGraph.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+// Same traversal as DFSCstm, neighbours read from compressed sparse rows
+class DFSCsr {
+private:
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    CSRView graph;
+    int num_nodes;
+    int edge_count;
+
+public:
+    DFSCsr() : num_nodes(0), edge_count(0) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // CSR shared through the store (mapped from the graph cache when there is one)
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        graph = store.csr();
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        std::vector<double> durations;
+        for (int it = 0; it < iterations; ++it) {
+            vector<int> nodePos(num_nodes, -1);
+            vector<bool> visited(num_nodes, false);
+            int counter = 0;
+            auto start = std::chrono::high_resolution_clock::now();
+
+            // DFS iterative
+            std::stack<int, vector<int>> s;
+            s.push(0); // 0'dan başla
+
+            while (!s.empty()) {
+                int u = s.top();
+                s.pop();
+
+                if (visited[u]) continue;
+
+                ++counter;
+                visited[u] = true;
+                if (nodePos[u] == -1) {
+                    nodePos[u] = counter;
+                }
+
+                for (const int *nb = graph.begin(u), *last = graph.end(u); nb != last; ++nb) {
+                    if (!visited[*nb]) {
+                        s.push(*nb);
+                    }
+                }
+            }
+
+            auto end = std::chrono::high_resolution_clock::now();
+            double duration = std::chrono::duration<double>(end - start).count();
+            durations.push_back(duration);
+
+            if (it == 0) {
+                writeResultArray(file, output_filename, ResultKind::VisitOrder, 0, nodePos);
+                file.close();
+            }
+        }
+        double avg = std::accumulate(durations.begin(), durations.end(), 0.0) / iterations;
+
+        std::cout << " csr Ortalama süre: " << avg << " s (" << graph.memoryBytes()
+                  << " bytes, adj list >= " << graph.adjListMemoryBytes() << " bytes)" << std::endl;
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "CSR : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif
@@ -3,17 +3,21 @@
 
 #include <iostream>
 #include <fstream>
-#include <sstream>
 #include <vector>
 #include <stack>
 #include <chrono>
+#include <memory>
 #include <numeric>
 
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
 using namespace std;
 
 class DFSCstm {
 private:
-    vector<vector<int>> adjList;
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    const GraphStore::AdjacencyList *graph = nullptr;
     int num_nodes;
     int edge_count;
 
@@ -21,36 +25,19 @@ public:
     DFSCstm() : num_nodes(0), edge_count(0) {}
 
     void readGraphFromFile(const std::string& filename) {
-        std::ifstream file(filename);
-        if (!file.is_open()) {
-            std::cerr << "Dosya açılamadı: " << filename << std::endl;
-            exit(1);
-        }
-        
-        std::string line;
-        while (std::getline(file, line)) {
-            if (line[0] == 'c') continue; // Yorum satırlarını atla
-            if (line[0] == 'p') {
-                std::stringstream ss(line);
-                std::string tmp;
-                ss >> tmp >> tmp >> num_nodes >> edge_count;
-                adjList.resize(num_nodes);
-            } else if (line[0] == 'a') {
-                std::stringstream ss(line);
-                char a;
-                int u, v;
-                ss >> a >> u >> v;
-                --u;
-                --v;
-                adjList[u].push_back(v);
-                adjList[v].push_back(u); 
-            }
-        }
-        file.close();
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Adjacency list shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        graph = &store.adjacencyList();
     }
 
     void compute(const std::string& output_filename, int iterations = 10) {
-        ofstream file(output_filename);
+        ResultWriter file(output_filename);
         if (!file.is_open()) {
             cerr << "File couldnt oppen!" << endl;
             return;
@@ -84,8 +71,8 @@ public:
                 }
                     
 
-                for (int v = 0; v < adjList[u].size(); ++v) {
-                    int neighbor = adjList[u][v];  
+                for (int v = 0; v < (*graph)[u].size(); ++v) {
+                    int neighbor = (*graph)[u][v];  
                     if (!visited[neighbor]) {
                         s.push(neighbor); 
                     }
@@ -97,10 +84,7 @@ public:
             durations.push_back(duration);
 
             if (it == 0) { 
-                for (int j = 1; j < nodePos.size(); ++j) {
-                    file << "Node 0 " << " -> " << j
-                         << " Shortest path: " << nodePos[j] << "\n";
-                }
+                writeResultArray(file, output_filename, ResultKind::VisitOrder, 0, nodePos);
                 file.close();
             }
         }
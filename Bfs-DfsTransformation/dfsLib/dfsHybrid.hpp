@@ -0,0 +1,115 @@
+#ifndef DFS__HYBRID__HPP
+#define DFS__HYBRID__HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <cstdint>
+
+#include "../graphLib/hybridAdjacency.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+// DFSBtwTemp traversal over HybridAdjacency. Both row kinds push the
+// unvisited neighbours in ascending order, so the discovery order is the
+// same as the bit-matrix engine.
+class DFSHybrid {
+private:
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    HybridAdjacency graph;
+    int num_nodes;
+    int edge_count;
+    int degree_threshold; // 0 = HybridAdjacency default
+    vector<int> s;
+
+public:
+    DFSHybrid(int threshold = 0) : num_nodes(0), edge_count(0), degree_threshold(threshold) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Built from the store's edge list, parsed once for all engines
+    void readGraph(GraphStore& store) { readEdges(store.edges()); }
+
+    void readEdges(const EdgeSpan& stream) {
+        num_nodes = stream.num_nodes;
+        edge_count = stream.edge_count;
+        graph.build(stream, degree_threshold);
+    }
+
+    void dfs(int start_node, vector<int>& nodePos) {
+        const size_t blocks = graph.blocksPerRow();
+        vector<uint64_t> visited(blocks, 0);
+        nodePos.assign(num_nodes, -1);
+        int counter = 0;
+
+        s.clear();
+        s.push_back(start_node);
+        while (!s.empty()) {
+            int topElement = s.back();
+            s.pop_back();
+
+            if (Block64::test(visited.data(), topElement)) continue;
+            Block64::set(visited.data(), topElement);
+            nodePos[topElement] = ++counter;
+
+            if (graph.isDense(topElement)) {
+                const uint64_t *row = graph.denseRow(topElement);
+                for (size_t b = 0; b < blocks; ++b) {
+                    uint64_t bits = row[b] & ~visited[b];
+                    while (bits) {
+                        s.push_back(b * 64 + __builtin_ctzll(bits));
+                        bits &= bits - 1; // deleteLSB
+                    }
+                }
+            } else {
+                for (const int *it = graph.sparseBegin(topElement), *end = graph.sparseEnd(topElement); it != end; ++it) {
+                    if (!Block64::test(visited.data(), *it)) s.push_back(*it);
+                }
+            }
+        }
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        std::vector<double> durations;
+        vector<int> nodePos;
+
+        for (int it = 0; it < iterations; ++it) {
+            auto start = std::chrono::high_resolution_clock::now();
+            dfs(0, nodePos); // 0'dan başla
+            auto end = std::chrono::high_resolution_clock::now();
+            durations.push_back(std::chrono::duration<double>(end - start).count());
+
+            if (it == 0) {
+                writeResultArray(file, output_filename, ResultKind::VisitOrder, 0, nodePos);
+                file.close();
+            }
+        }
+
+        double avg = std::accumulate(durations.begin(), durations.end(), 0.0) / iterations;
+        std::cout << "hybrid Ortalama süre: " << avg << " s (" << graph.denseCount() << "/" << num_nodes
+                  << " dense rows)" << std::endl;
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << "Hybrid : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif
@@ -0,0 +1,230 @@
+#ifndef DFS__PAR__HPP
+#define DFS__PAR__HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <stack>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <memory>
+#include <cstdint>
+
+#include "../graphLib/threadPool.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+// Multithreaded DFS-like spanning forest. Every thread works on its own
+// stack; a thread whose stack is empty steals the older half of another
+// thread's stack, where the largest unexplored subtrees sit. A vertex
+// belongs to the thread whose fetch_or set its visited bit first, that
+// thread records the parent and pushes it. New roots are only taken when
+// no claimed vertex is left unexpanded, so every tree is a whole
+// component. The visit order is not a sequential DFS order.
+class DFSPar {
+private:
+    struct alignas(64) WorkStack {
+        std::mutex mtx;
+        vector<int> items;
+    };
+
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    const GraphStore::AdjacencyList *graph = nullptr;
+    int num_nodes;
+    int edge_count;
+    int max_threads;
+
+    // Shared state of one run
+    vector<std::atomic<uint64_t>> visited;
+    vector<WorkStack> stacks;
+    std::atomic<long> outstanding; // claimed but not yet expanded vertices
+    std::mutex rootMtx;
+    int rootCursor;
+
+    bool claim(int v) {
+        const uint64_t mask = (uint64_t)1 << (v % 64);
+        auto &block = visited[v / 64];
+        if (block.load(std::memory_order_relaxed) & mask) return false;
+        return !(block.fetch_or(mask, std::memory_order_acq_rel) & mask);
+    }
+
+    bool pop(int tid, int& v) {
+        WorkStack &own = stacks[tid];
+        std::lock_guard<std::mutex> lock(own.mtx);
+        if (own.items.empty()) return false;
+        v = own.items.back();
+        own.items.pop_back();
+        return true;
+    }
+
+    bool steal(int tid, int thread_num) {
+        for (int k = 1; k < thread_num; ++k) {
+            WorkStack &victim = stacks[(tid + k) % thread_num];
+            vector<int> loot;
+            {
+                std::lock_guard<std::mutex> lock(victim.mtx);
+                const size_t half = victim.items.size() / 2;
+                if (half == 0) continue;
+                loot.assign(victim.items.begin(), victim.items.begin() + half);
+                victim.items.erase(victim.items.begin(), victim.items.begin() + half);
+            }
+            WorkStack &own = stacks[tid];
+            std::lock_guard<std::mutex> lock(own.mtx);
+            own.items.insert(own.items.end(), loot.begin(), loot.end());
+            return true;
+        }
+        return false;
+    }
+
+    // Claims the next unvisited vertex as a root once all trees are done;
+    // false when every vertex is visited
+    bool nextRoot(int tid, vector<int>& parent, bool& finished) {
+        std::lock_guard<std::mutex> lock(rootMtx);
+        if (outstanding.load(std::memory_order_acquire) != 0) return false;
+        while (rootCursor < num_nodes && !claim(rootCursor)) ++rootCursor;
+        if (rootCursor == num_nodes) {
+            finished = true;
+            return false;
+        }
+        parent[rootCursor] = -1;
+        outstanding.store(1, std::memory_order_release);
+        WorkStack &own = stacks[tid];
+        std::lock_guard<std::mutex> own_lock(own.mtx);
+        own.items.push_back(rootCursor);
+        return true;
+    }
+
+    void worker(int tid, int thread_num, vector<int>& parent) {
+        vector<int> claimed;
+        bool finished = false;
+        while (!finished) {
+            int u;
+            if (pop(tid, u)) {
+                claimed.clear();
+                for (int neighbor : (*graph)[u]) {
+                    if (claim(neighbor)) {
+                        parent[neighbor] = u;
+                        claimed.push_back(neighbor);
+                    }
+                }
+                if (!claimed.empty()) {
+                    outstanding.fetch_add(claimed.size(), std::memory_order_acq_rel);
+                    WorkStack &own = stacks[tid];
+                    std::lock_guard<std::mutex> lock(own.mtx);
+                    own.items.insert(own.items.end(), claimed.rbegin(), claimed.rend());
+                }
+                outstanding.fetch_sub(1, std::memory_order_acq_rel);
+                continue;
+            }
+            if (steal(tid, thread_num)) continue;
+            if (nextRoot(tid, parent, finished)) continue;
+            std::this_thread::yield();
+        }
+    }
+
+public:
+    DFSPar(int max_threads = 0) : num_nodes(0), edge_count(0), max_threads(max_threads), outstanding(0), rootCursor(0) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Adjacency list shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        graph = &store.adjacencyList();
+    }
+
+    // parent[v] = tree parent of v, -1 for roots; vertex 0 is the first root
+    vector<int> spanningForest(ThreadPool& pool) {
+        const int thread_num = pool.size();
+        vector<int> parent(num_nodes, -1);
+        visited = vector<std::atomic<uint64_t>>((num_nodes + 63) / 64);
+        for (auto &block : visited) block.store(0, std::memory_order_relaxed);
+        stacks = vector<WorkStack>(thread_num);
+        outstanding.store(0, std::memory_order_relaxed);
+        rootCursor = 0;
+
+        pool.run([&](int tid) { worker(tid, thread_num, parent); });
+        return parent;
+    }
+
+    // Sequential reference: the DFSCstm traversal over the same lists,
+    // restarted from every unvisited vertex
+    double sequentialTime(int iterations) {
+        double total_time = 0.0;
+        for (int it = 0; it < iterations; ++it) {
+            auto start = std::chrono::high_resolution_clock::now();
+            vector<bool> visitedSeq(num_nodes, false);
+            std::stack<int> s;
+            for (int root = 0; root < num_nodes; ++root) {
+                if (visitedSeq[root]) continue;
+                s.push(root);
+                while (!s.empty()) {
+                    int u = s.top();
+                    s.pop();
+                    if (visitedSeq[u]) continue;
+                    visitedSeq[u] = true;
+                    for (int neighbor : (*graph)[u]) {
+                        if (!visitedSeq[neighbor]) s.push(neighbor);
+                    }
+                }
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            total_time += std::chrono::duration<double>(end - start).count();
+        }
+        return total_time / iterations;
+    }
+
+    // Ormanı 1..N thread ile hesapla
+    void compute(const std::string& output_filename, int iterations = 10) {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+
+        vector<int> steps = scalingSteps(max_threads);
+        vector<double> averages;
+        const double cstm_avg = sequentialTime(iterations);
+
+        for (int thread_num : steps) {
+            ThreadPool pool(thread_num);
+            double total_time = 0.0;
+            for (int it = 0; it < iterations; ++it) {
+                auto start = std::chrono::high_resolution_clock::now();
+                vector<int> parent = spanningForest(pool);
+                auto end = std::chrono::high_resolution_clock::now();
+                total_time += std::chrono::duration<double>(end - start).count();
+
+                if (it == 0 && averages.empty()) {
+                    for (int j = 0; j < num_nodes; ++j) {
+                        file << "Node " << j << " parent: " << parent[j] << "\n";
+                    }
+                    file.close();
+                }
+            }
+            averages.push_back(total_time / iterations);
+        }
+
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        for (size_t k = 0; k < steps.size(); ++k) {
+            std::cout << "parallel " << steps[k] << " thread Ortalama süre: " << averages[k]
+                      << " s (speedup vs cstm " << cstm_avg / averages[k] << "x)" << std::endl;
+            file2 << "Par x" << steps[k] << " : " << averages[k] << " s" << endl;
+        }
+        file2.close();
+    }
+};
+
+#endif
@@ -0,0 +1,242 @@
+#ifndef DFS__SCC__HPP
+#define DFS__SCC__HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <cstdint>
+
+#include "../graphLib/directedBitMatrix.hpp"
+#include "../graphLib/threadPool.hpp"
+#include "../graphLib/components.hpp"
+#include "../graphLib/graphStore.hpp"
+
+// Subsets with fewer vertices are finished by the thread that split them
+// instead of going through the shared queue
+#define SCC_SHARE_MIN 64
+
+using namespace std;
+
+// Strongly connected components of the directed graph with FW-BW
+// (Fleischer, Hendrickson, Pinar). A task is a vertex subset S as a
+// bitset. Vertices without an in or out arc inside S are trimmed as
+// singletons; then FW / BW = vertices of S reachable from / reaching a
+// pivot, grown row-wise like the frontier-bitset BFS. FW & BW is one SCC
+// and FW \ SCC, BW \ SCC, S \ (FW | BW) become independent tasks that
+// the pool threads pick up.
+class SCCBtw {
+private:
+    using Set = vector<uint64_t>;
+
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+
+    struct Scratch {
+        Set fw, bw, frontier, next;
+    };
+
+    DirectedBitMatrix<Block64> graph;
+    int num_nodes;
+    int edge_count;
+    int max_threads;
+    size_t block_num;
+    const bit_kernels *kernels;
+
+    // Shared state of one run
+    std::deque<Set> tasks;
+    std::mutex mtx;
+    std::condition_variable cv;
+    int pending; // tasks queued or being processed
+    std::atomic<int> nextId;
+    vector<int> *ids;
+
+    // result = vertices of set reachable from pivot over the rows of m
+    void reach(const BitMatrix<Block64>& m, int pivot, const uint64_t *set, Set& result, Scratch& sc) {
+        std::fill(result.begin(), result.end(), 0);
+        std::fill(sc.frontier.begin(), sc.frontier.end(), 0);
+        Block64::set(result.data(), pivot);
+        Block64::set(sc.frontier.data(), pivot);
+        while (true) {
+            std::fill(sc.next.begin(), sc.next.end(), 0);
+            for (size_t b = 0; b < block_num; ++b) {
+                uint64_t bits = sc.frontier[b];
+                while (bits) {
+                    kernels->or_into(sc.next.data(), m.row(b * 64 + __builtin_ctzll(bits)), block_num);
+                    bits &= bits - 1;
+                }
+            }
+            kernels->and_into(sc.next.data(), set, block_num);
+            kernels->andnot_into(sc.next.data(), result.data(), block_num);
+            if (kernels->find_first(sc.next.data(), block_num) < 0) break;
+            kernels->or_into(result.data(), sc.next.data(), block_num);
+            sc.frontier.swap(sc.next);
+        }
+    }
+
+    // Removes vertices with no arc into or out of S until none is left
+    void trim(Set& s) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t b = 0; b < block_num; ++b) {
+                uint64_t bits = s[b];
+                while (bits) {
+                    const int v = b * 64 + __builtin_ctzll(bits);
+                    bits &= bits - 1;
+                    if (!kernels->intersects(graph.out.row(v), s.data(), block_num) ||
+                        !kernels->intersects(graph.in.row(v), s.data(), block_num)) {
+                        (*ids)[v] = nextId.fetch_add(1, std::memory_order_relaxed);
+                        s[b] &= ~((uint64_t)1 << (v % 64));
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+
+    void push(Set&& s, vector<Set>& local) {
+        if (kernels->popcount(s.data(), block_num) < SCC_SHARE_MIN) {
+            local.push_back(std::move(s));
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            tasks.push_back(std::move(s));
+            ++pending;
+        }
+        cv.notify_one();
+    }
+
+    void process(Set& s, Scratch& sc, vector<Set>& local) {
+        trim(s);
+        const long pivot = kernels->find_first(s.data(), block_num);
+        if (pivot < 0) return;
+
+        reach(graph.out, pivot, s.data(), sc.fw, sc);
+        reach(graph.in, pivot, s.data(), sc.bw, sc);
+
+        const int id = nextId.fetch_add(1, std::memory_order_relaxed);
+        Set fwOnly(block_num), bwOnly(block_num), rest(block_num);
+        for (size_t b = 0; b < block_num; ++b) {
+            uint64_t scc = sc.fw[b] & sc.bw[b];
+            fwOnly[b] = sc.fw[b] & ~scc;
+            bwOnly[b] = sc.bw[b] & ~scc;
+            rest[b] = s[b] & ~(sc.fw[b] | sc.bw[b]);
+            while (scc) {
+                (*ids)[b * 64 + __builtin_ctzll(scc)] = id;
+                scc &= scc - 1;
+            }
+        }
+        for (Set *part : {&fwOnly, &bwOnly, &rest}) {
+            if (kernels->find_first(part->data(), block_num) >= 0) push(std::move(*part), local);
+        }
+    }
+
+    void worker() {
+        Scratch sc{Set(block_num), Set(block_num), Set(block_num), Set(block_num)};
+        vector<Set> local;
+        while (true) {
+            Set s;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cv.wait(lock, [&] { return !tasks.empty() || pending == 0; });
+                if (tasks.empty()) return;
+                s = std::move(tasks.front());
+                tasks.pop_front();
+            }
+
+            local.push_back(std::move(s));
+            while (!local.empty()) {
+                Set current = std::move(local.back());
+                local.pop_back();
+                process(current, sc, local);
+            }
+
+            std::lock_guard<std::mutex> lock(mtx);
+            if (--pending == 0) cv.notify_all();
+        }
+    }
+
+public:
+    SCCBtw(int max_threads = 0)
+        : num_nodes(0), edge_count(0), max_threads(max_threads), block_num(0), kernels(bit_kernels_get()),
+          pending(0), nextId(0), ids(nullptr) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Built from the store's edge list, parsed once for all engines
+    void readGraph(GraphStore& store) { readEdges(store.edges()); }
+
+    void readEdges(const EdgeSpan& stream) {
+        num_nodes = stream.num_nodes;
+        edge_count = stream.edge_count;
+        graph.build(stream);
+        block_num = graph.blocksPerRow();
+    }
+
+    Components components(ThreadPool& pool) {
+        Components result;
+        result.id.assign(num_nodes, -1);
+        if (num_nodes == 0) return result;
+
+        Set all(block_num, ~(uint64_t)0);
+        if (num_nodes % 64) all[block_num - 1] = ((uint64_t)1 << (num_nodes % 64)) - 1;
+
+        ids = &result.id;
+        nextId.store(0, std::memory_order_relaxed);
+        tasks.clear();
+        tasks.push_back(std::move(all));
+        pending = 1;
+        pool.run([&](int) { worker(); });
+
+        result.normalize(nextId.load(std::memory_order_relaxed));
+        return result;
+    }
+
+    // SCC'leri 1..N thread ile hesapla
+    void compute(const std::string& output_filename, int iterations = 10) {
+        vector<int> steps = scalingSteps(max_threads);
+        vector<double> averages;
+        size_t component_num = 0;
+
+        for (int thread_num : steps) {
+            ThreadPool pool(thread_num);
+            double total_time = 0.0;
+            for (int i = 0; i < iterations; i++) {
+                auto start_time = std::chrono::high_resolution_clock::now();
+                Components result = components(pool);
+                auto end_time = std::chrono::high_resolution_clock::now();
+                total_time += std::chrono::duration<double>(end_time - start_time).count();
+
+                if (i == 0 && averages.empty()) {
+                    result.write(output_filename);
+                    component_num = result.sizes.size();
+                }
+            }
+            averages.push_back(total_time / iterations);
+        }
+
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        for (size_t k = 0; k < steps.size(); ++k) {
+            std::cout << "fw-bw scc " << steps[k] << " thread Ortalama süre: " << averages[k]
+                      << " s (" << component_num << " components, speedup "
+                      << averages[0] / averages[k] << "x)" << std::endl;
+            file2 << "Btw SCC x" << steps[k] << " : " << averages[k] << " s" << endl;
+        }
+        file2.close();
+    }
+};
+
+#endif
@@ -0,0 +1,224 @@
+#ifndef DFS__TOPO__HPP
+#define DFS__TOPO__HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <algorithm>
+#include <cstdint>
+
+#include "../graphLib/directedBitMatrix.hpp"
+#include "../graphLib/csrGraph.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+// Which representation DFSTopo runs on. Auto takes bit rows when the
+// average out-degree is at least N / 64, the point where a row scan costs
+// no more than walking the arc list.
+enum class TopoMode {
+    Auto,
+    Bitset,
+    Csr
+};
+
+// order holds every vertex in topological order when the directed graph
+// is acyclic; otherwise order is the acyclic prefix Kahn could peel off
+// and cycle is one directed cycle c0 -> c1 -> ... -> c0.
+struct TopoResult {
+    bool acyclic = true;
+    vector<int> order;
+    vector<int> cycle;
+
+    void write(const std::string& output_filename) const {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+        file << "Acyclic: " << (acyclic ? "yes" : "no") << "\n";
+        file << "Order (" << order.size() << "):";
+        for (int v : order) file << " " << v;
+        file << "\n";
+        if (!acyclic) {
+            file << "Cycle (" << cycle.size() << "):";
+            for (int v : cycle) file << " " << v;
+            file << "\n";
+        }
+    }
+};
+
+// Kahn's algorithm on the directed graph (arcs as given, not mirrored)
+class DFSTopo {
+private:
+    using Set = vector<uint64_t>;
+
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    DirectedBitMatrix<Block64> matrix;
+    CSRGraph graph;
+    int num_nodes;
+    int edge_count;
+    TopoMode mode;
+    bool useBitset;
+    const bit_kernels *kernels;
+
+    // Level by level: in-degrees come from popcounts of the in-rows (the
+    // columns of the matrix), each peeled level is removed from the
+    // remaining set with one word-wise ANDNOT, and the next level is every
+    // out-neighbour of the level whose in-row no longer meets the
+    // remaining set.
+    void kahnBitset(TopoResult& result) {
+        const size_t block_num = matrix.blocksPerRow();
+        Set remaining(block_num, 0), frontier(block_num, 0), candidates(block_num, 0);
+        for (int v = 0; v < num_nodes; ++v) {
+            Block64::set(remaining.data(), v);
+            if (kernels->popcount(matrix.in.row(v), block_num) == 0) Block64::set(frontier.data(), v);
+        }
+
+        while (kernels->find_first(frontier.data(), block_num) >= 0) {
+            kernels->andnot_into(remaining.data(), frontier.data(), block_num);
+            std::fill(candidates.begin(), candidates.end(), 0);
+            for (size_t b = 0; b < block_num; ++b) {
+                uint64_t bits = frontier[b];
+                while (bits) {
+                    const int u = b * 64 + __builtin_ctzll(bits);
+                    result.order.push_back(u);
+                    kernels->or_into(candidates.data(), matrix.out.row(u), block_num);
+                    bits &= bits - 1;
+                }
+            }
+            kernels->and_into(candidates.data(), remaining.data(), block_num);
+
+            std::fill(frontier.begin(), frontier.end(), 0);
+            for (size_t b = 0; b < block_num; ++b) {
+                uint64_t bits = candidates[b];
+                while (bits) {
+                    const int v = b * 64 + __builtin_ctzll(bits);
+                    if (!kernels->intersects(matrix.in.row(v), remaining.data(), block_num)) Block64::set(frontier.data(), v);
+                    bits &= bits - 1;
+                }
+            }
+        }
+
+        if ((int)result.order.size() == num_nodes) return;
+        // Every remaining vertex has an in-neighbour that remains: walking
+        // backwards must close a cycle
+        result.acyclic = false;
+        vector<int> pos(num_nodes, -1);
+        vector<int> walk;
+        int v = (int)kernels->find_first(remaining.data(), block_num);
+        while (pos[v] < 0) {
+            pos[v] = (int)walk.size();
+            walk.push_back(v);
+            const uint64_t *in = matrix.in.row(v);
+            int pred = -1;
+            for (size_t b = 0; b < block_num && pred < 0; ++b) {
+                if (uint64_t bits = in[b] & remaining[b]) pred = b * 64 + __builtin_ctzll(bits);
+            }
+            v = pred;
+        }
+        result.cycle.assign(walk.rbegin(), walk.rend() - pos[v]);
+    }
+
+    void kahnCsr(TopoResult& result) {
+        vector<int> indegree(num_nodes, 0);
+        for (int v : graph.neighbors) ++indegree[v];
+
+        vector<int> &q = result.order;
+        q.reserve(num_nodes);
+        for (int v = 0; v < num_nodes; ++v) {
+            if (indegree[v] == 0) q.push_back(v);
+        }
+        for (size_t head = 0; head < q.size(); ++head) {
+            for (const int *it = graph.begin(q[head]), *end = graph.end(q[head]); it != end; ++it) {
+                if (--indegree[*it] == 0) q.push_back(*it);
+            }
+        }
+
+        if ((int)q.size() == num_nodes) return;
+        // Iterative DFS over the vertices Kahn left behind until an arc
+        // points back into the current path
+        result.acyclic = false;
+        vector<char> color(num_nodes, 0); // 0 new, 1 on path, 2 done
+        vector<int> next(num_nodes, 0), path;
+        for (int root = 0; root < num_nodes && result.cycle.empty(); ++root) {
+            if (indegree[root] == 0 || color[root]) continue;
+            path.assign(1, root);
+            color[root] = 1;
+            while (!path.empty() && result.cycle.empty()) {
+                const int u = path.back();
+                if (next[u] == graph.degree(u)) {
+                    color[u] = 2;
+                    path.pop_back();
+                    continue;
+                }
+                const int w = graph.begin(u)[next[u]++];
+                if (indegree[w] == 0 || color[w] == 2) continue;
+                if (color[w] == 1) {
+                    result.cycle.assign(std::find(path.begin(), path.end(), w), path.end());
+                } else {
+                    color[w] = 1;
+                    path.push_back(w);
+                }
+            }
+        }
+    }
+
+public:
+    DFSTopo(TopoMode mode = TopoMode::Auto)
+        : num_nodes(0), edge_count(0), mode(mode), useBitset(false), kernels(bit_kernels_get()) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Built from the store's edge list, parsed once for all engines
+    void readGraph(GraphStore& store) { readEdges(store.edges()); }
+
+    void readEdges(const EdgeSpan& stream) {
+        num_nodes = stream.num_nodes;
+        edge_count = stream.edge_count;
+        useBitset = mode == TopoMode::Bitset ||
+                    (mode == TopoMode::Auto && (int64_t)stream.edges.size() * 64 >= (int64_t)num_nodes * num_nodes);
+        if (useBitset) matrix.build(stream);
+        else graph.build(stream, true);
+    }
+
+    TopoResult topologicalSort() {
+        TopoResult result;
+        if (useBitset) kahnBitset(result);
+        else kahnCsr(result);
+        return result;
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        std::vector<double> durations;
+        TopoResult result;
+        for (int it = 0; it < iterations; ++it) {
+            auto start = std::chrono::high_resolution_clock::now();
+            result = topologicalSort();
+            auto end = std::chrono::high_resolution_clock::now();
+            durations.push_back(std::chrono::duration<double>(end - start).count());
+            if (it == 0) result.write(output_filename);
+        }
+
+        double avg = std::accumulate(durations.begin(), durations.end(), 0.0) / iterations;
+        const std::string label = useBitset ? "Btw Topo" : "CSR Topo";
+        std::cout << label << " Ortalama süre: " << avg << " s ("
+                  << (result.acyclic ? "acyclic" : "cycle of " + std::to_string(result.cycle.size())) << ")" << std::endl;
+        ofstream file2("result.txt",  ios::app);
+        if (!file2.is_open()) {
+            cerr << "File couldn't open!" << endl;
+            return;
+        }
+        file2 << label << " : " << avg << " s" << endl;
+        file2.close();
+    }
+};
+
+#endif
@@ -0,0 +1,287 @@
+#ifndef DFS__TREE__HPP
+#define DFS__TREE__HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include "../graphLib/bitMatrix.hpp"
+#include "../graphLib/graphStore.hpp"
+#include "../graphLib/resultWriter.hpp"
+
+using namespace std;
+
+// Everything one DFS pass over the whole graph can tell. discovery and
+// finish share one clock (1 .. 2N), low is the smallest discovery time
+// reachable from the subtree of v with at most one back edge, parent is
+// -1 for tree roots. Articulation points and bridges fall out of the
+// low-links while the traversal backtracks, no second pass needed.
+struct DFSTree {
+    vector<int> discovery;
+    vector<int> finish;
+    vector<int> parent;
+    vector<int> low;
+    vector<int> articulationPoints;      // ascending
+    vector<pair<int, int>> bridges;      // (parent, child) tree edges, ascending
+
+    void reset(int num_nodes) {
+        discovery.assign(num_nodes, 0);
+        finish.assign(num_nodes, 0);
+        parent.assign(num_nodes, -1);
+        low.assign(num_nodes, 0);
+        articulationPoints.clear();
+        bridges.clear();
+    }
+
+    // Called when child is finished and control returns to its parent u
+    void backtrack(int u, int child, vector<int>& rootChildren, vector<char>& isCut) {
+        low[u] = std::min(low[u], low[child]);
+        if (low[child] > discovery[u]) bridges.push_back({u, child});
+        if (parent[u] == -1) ++rootChildren[u];
+        else if (low[child] >= discovery[u]) isCut[u] = 1;
+    }
+
+    void finalize(vector<int>& rootChildren, vector<char>& isCut) {
+        const int num_nodes = (int)discovery.size();
+        for (int v = 0; v < num_nodes; ++v) {
+            if (parent[v] == -1 ? rootChildren[v] > 1 : isCut[v]) articulationPoints.push_back(v);
+        }
+        std::sort(bridges.begin(), bridges.end());
+    }
+
+    void write(const std::string& output_filename) const {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            cerr << "File couldnt oppen!" << endl;
+            return;
+        }
+        for (size_t v = 0; v < discovery.size(); ++v) {
+            file << "Node " << v << " discovery: " << discovery[v] << " finish: " << finish[v]
+                 << " parent: " << parent[v] << " low: " << low[v] << "\n";
+        }
+        file << "Articulation points (" << articulationPoints.size() << "):";
+        for (int v : articulationPoints) file << " " << v;
+        file << "\nBridges (" << bridges.size() << "):";
+        for (const auto &b : bridges) file << " " << b.first << "-" << b.second;
+        file << "\n";
+    }
+};
+
+// Timing and output shared by the DFS tree engines
+template <typename Engine>
+void computeDfsTree(Engine& engine, const std::string& label, const std::string& output_filename, int iterations) {
+    DFSTree tree;
+    std::vector<double> durations;
+    for (int it = 0; it < iterations; ++it) {
+        auto start = std::chrono::high_resolution_clock::now();
+        engine.dfsTree(0, tree); // 0'dan başla
+        auto end = std::chrono::high_resolution_clock::now();
+        durations.push_back(std::chrono::duration<double>(end - start).count());
+        if (it == 0) tree.write(output_filename);
+    }
+
+    double avg = std::accumulate(durations.begin(), durations.end(), 0.0) / iterations;
+    std::cout << label << " Ortalama süre: " << avg << " s (" << tree.articulationPoints.size()
+              << " articulation points, " << tree.bridges.size() << " bridges)" << std::endl;
+    ofstream file2("result.txt",  ios::app);
+    if (!file2.is_open()) {
+        cerr << "File couldn't open!" << endl;
+        return;
+    }
+    file2 << label << " : " << avg << " s" << endl;
+    file2.close();
+}
+
+// DFS tree on the adjacency list. Parallel edges are kept, so a doubled
+// edge is never reported as a bridge: only the first copy of the edge to
+// the parent is skipped.
+class DFSTreeCstm {
+private:
+    struct Frame {
+        int vertex;
+        int next;             // index into the neighbours of vertex
+        bool skippedParent;
+    };
+
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    const GraphStore::AdjacencyList *graph = nullptr;
+    int num_nodes;
+    int edge_count;
+    vector<Frame> s;
+    vector<int> rootChildren;
+    vector<char> isCut;
+
+public:
+    DFSTreeCstm() : num_nodes(0), edge_count(0) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Adjacency list shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        graph = &store.adjacencyList();
+    }
+
+    // Forest rooted at start_node first, then at every unvisited vertex in order
+    void dfsTree(int start_node, DFSTree& tree) {
+        tree.reset(num_nodes);
+        rootChildren.assign(num_nodes, 0);
+        isCut.assign(num_nodes, 0);
+        int clock = 0;
+
+        for (int r = -1; r < num_nodes; ++r) {
+            const int root = r < 0 ? start_node : r;
+            if (tree.discovery[root]) continue;
+
+            tree.discovery[root] = tree.low[root] = ++clock;
+            s.clear();
+            s.push_back({root, 0, false});
+            while (!s.empty()) {
+                Frame &top = s.back();
+                const int u = top.vertex;
+                const vector<int> &adj = (*graph)[u];
+
+                if (top.next < (int)adj.size()) {
+                    const int w = adj[top.next++];
+                    if (!tree.discovery[w]) {
+                        tree.parent[w] = u;
+                        tree.discovery[w] = tree.low[w] = ++clock;
+                        s.push_back({w, 0, false}); // top is invalid from here on
+                    } else if (w == tree.parent[u] && !top.skippedParent) {
+                        top.skippedParent = true;
+                    } else {
+                        tree.low[u] = std::min(tree.low[u], tree.discovery[w]);
+                    }
+                    continue;
+                }
+
+                tree.finish[u] = ++clock;
+                s.pop_back();
+                if (!s.empty()) tree.backtrack(s.back().vertex, u, rootChildren, isCut);
+            }
+        }
+        tree.finalize(rootChildren, isCut);
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        computeDfsTree(*this, "Tree", output_filename, iterations);
+    }
+};
+
+// DFS tree on the bit matrix with the cursor frames of DFSBtwCursor. In an
+// undirected DFS every neighbour already visited when u is discovered is
+// an ancestor of u, so the back edges of u are row(u) & visited at that
+// moment. The matrix cannot hold parallel edges: bridges are those of the
+// simple graph.
+template <typename Block = Block64>
+class DFSTreeBtwT {
+public:
+    using block_t = typename Block::type;
+
+private:
+    struct Frame {
+        int vertex;
+        int block;
+    };
+
+    std::unique_ptr<GraphStore> ownStore; // graph of readGraphFromFile
+    BitMatrix<Block> adjMatrix;
+    int num_nodes;
+    int edge_count;
+    vector<Frame> s;
+    vector<int> rootChildren;
+    vector<char> isCut;
+
+    // Discovers v (child of p or a root when p == -1) and folds its back edges into low[v]
+    void discover(int v, int p, int& clock, block_t *visited, DFSTree& tree, size_t block_num) {
+        tree.parent[v] = p;
+        tree.discovery[v] = tree.low[v] = ++clock;
+        const block_t *row = adjMatrix.row(v);
+        for (size_t b = 0; b < block_num; ++b) {
+            block_t bits = row[b] & visited[b];
+            while (Block::any(bits)) {
+                const int w = b * Block::bits + Block::ctz(bits);
+                if (w != p) tree.low[v] = std::min(tree.low[v], tree.discovery[w]);
+                bits = Block::clearLowest(bits);
+            }
+        }
+        Block::set(visited, v);
+    }
+
+public:
+    DFSTreeBtwT() : num_nodes(0), edge_count(0) {}
+
+    void readGraphFromFile(const std::string& filename) {
+        ownStore = std::make_unique<GraphStore>(filename);
+        readGraph(*ownStore);
+    }
+
+    // Bit-matrix rows shared through the store
+    void readGraph(GraphStore& store) {
+        num_nodes = store.nodeCount();
+        edge_count = store.edgeCount();
+        adjMatrix = store.bitMatrix<Block>();
+    }
+
+    // Forest rooted at start_node first, then at every unvisited vertex in order
+    void dfsTree(int start_node, DFSTree& tree) {
+        const int block_num = (int)Block::blockCount(num_nodes);
+        vector<block_t> visited(block_num, Block::zero());
+        tree.reset(num_nodes);
+        rootChildren.assign(num_nodes, 0);
+        isCut.assign(num_nodes, 0);
+        int clock = 0;
+
+        for (int r = -1; r < num_nodes; ++r) {
+            const int root = r < 0 ? start_node : r;
+            if (Block::test(visited.data(), root)) continue;
+
+            discover(root, -1, clock, visited.data(), tree, block_num);
+            s.clear();
+            s.push_back({root, 0});
+            while (!s.empty()) {
+                Frame &top = s.back();
+                const int u = top.vertex;
+                const block_t *row = adjMatrix.row(u);
+
+                int child = -1;
+                for (; top.block < block_num; ++top.block) {
+                    block_t bits = row[top.block] & ~visited[top.block];
+                    if (Block::any(bits)) {
+                        child = top.block * Block::bits + Block::ctz(bits);
+                        break;
+                    }
+                }
+
+                if (child >= 0) {
+                    discover(child, u, clock, visited.data(), tree, block_num);
+                    s.push_back({child, 0}); // top is invalid from here on
+                    continue;
+                }
+
+                tree.finish[u] = ++clock;
+                s.pop_back();
+                if (!s.empty()) tree.backtrack(s.back().vertex, u, rootChildren, isCut);
+            }
+        }
+        tree.finalize(rootChildren, isCut);
+    }
+
+    void compute(const std::string& output_filename, int iterations = 10) {
+        computeDfsTree(*this, "Btw Tree", output_filename, iterations);
+    }
+};
+
+using DFSTreeBtw = DFSTreeBtwT<Block64>;
+
+#endif
@@ -0,0 +1,355 @@
+#ifndef BIT_KERNELS_H
+#define BIT_KERNELS_H
+
+/*
+ * Row kernels over 64-bit bit rows (n = number of uint64_t words).
+ * Each kernel has a scalar, an AVX2 and an AVX-512 (F + VPOPCNTDQ)
+ * variant; bit_kernels_get() picks the widest one the host supports via
+ * CPUID on first use. Usable from both C (stdgraph.c) and C++.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BK_X86 1
+#endif
+
+typedef struct bit_kernels {
+    const char *name;
+    void (*or_into)(uint64_t *dst, const uint64_t *src, size_t n);          /* dst |= src        */
+    void (*and_into)(uint64_t *dst, const uint64_t *src, size_t n);         /* dst &= src        */
+    void (*andnot_into)(uint64_t *dst, const uint64_t *src, size_t n);      /* dst &= ~src       */
+    void (*andnot_copy)(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n); /* dst = a & ~b */
+    size_t (*popcount)(const uint64_t *a, size_t n);
+    size_t (*popcount_and)(const uint64_t *a, const uint64_t *b, size_t n);
+    bool (*intersects)(const uint64_t *a, const uint64_t *b, size_t n);     /* (a & b) != 0      */
+    long (*find_first)(const uint64_t *a, size_t n);                        /* first set bit, -1 */
+    long (*find_first_andnot)(const uint64_t *a, const uint64_t *b, size_t n); /* in a & ~b, -1  */
+} bit_kernels;
+
+
+/* ---- scalar ---------------------------------------------------------- */
+
+static void bk_or_into_scalar(uint64_t *dst, const uint64_t *src, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] |= src[i];
+}
+
+static void bk_and_into_scalar(uint64_t *dst, const uint64_t *src, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] &= src[i];
+}
+
+static void bk_andnot_into_scalar(uint64_t *dst, const uint64_t *src, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] &= ~src[i];
+}
+
+static void bk_andnot_copy_scalar(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = a[i] & ~b[i];
+}
+
+static size_t bk_popcount_scalar(const uint64_t *a, size_t n) {
+    size_t total = 0;
+    for (size_t i = 0; i < n; i++) total += __builtin_popcountll(a[i]);
+    return total;
+}
+
+static size_t bk_popcount_and_scalar(const uint64_t *a, const uint64_t *b, size_t n) {
+    size_t total = 0;
+    for (size_t i = 0; i < n; i++) total += __builtin_popcountll(a[i] & b[i]);
+    return total;
+}
+
+static bool bk_intersects_scalar(const uint64_t *a, const uint64_t *b, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        if (a[i] & b[i]) return true;
+    return false;
+}
+
+static long bk_find_first_scalar(const uint64_t *a, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        if (a[i]) return (long)(i * 64 + __builtin_ctzll(a[i]));
+    return -1;
+}
+
+static long bk_find_first_andnot_scalar(const uint64_t *a, const uint64_t *b, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint64_t bits = a[i] & ~b[i];
+        if (bits) return (long)(i * 64 + __builtin_ctzll(bits));
+    }
+    return -1;
+}
+
+
+#ifdef BK_X86
+
+/* ---- AVX2: 4 words per step ------------------------------------------ */
+
+#define BK_AVX2 __attribute__((target("avx2,popcnt")))
+
+static BK_AVX2 void bk_or_into_avx2(uint64_t *dst, const uint64_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)(dst + i));
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_or_si256(d, s));
+    }
+    for (; i < n; i++) dst[i] |= src[i];
+}
+
+static BK_AVX2 void bk_and_into_avx2(uint64_t *dst, const uint64_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)(dst + i));
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_and_si256(d, s));
+    }
+    for (; i < n; i++) dst[i] &= src[i];
+}
+
+static BK_AVX2 void bk_andnot_into_avx2(uint64_t *dst, const uint64_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)(dst + i));
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_andnot_si256(s, d));
+    }
+    for (; i < n; i++) dst[i] &= ~src[i];
+}
+
+static BK_AVX2 void bk_andnot_copy_avx2(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_andnot_si256(vb, va));
+    }
+    for (; i < n; i++) dst[i] = a[i] & ~b[i];
+}
+
+/* Nibble lookup popcount (Mula), byte counts summed with vpsadbw */
+static BK_AVX2 __m256i bk_popcount256(__m256i v) {
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_and_si256(v, low_mask);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+    __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+    return _mm256_sad_epu8(cnt, _mm256_setzero_si256());
+}
+
+static BK_AVX2 size_t bk_hsum256(__m256i v) {
+    __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    return (size_t)(_mm_cvtsi128_si64(sum) + _mm_extract_epi64(sum, 1));
+}
+
+static BK_AVX2 size_t bk_popcount_avx2(const uint64_t *a, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        acc = _mm256_add_epi64(acc, bk_popcount256(_mm256_loadu_si256((const __m256i *)(a + i))));
+    size_t total = bk_hsum256(acc);
+    for (; i < n; i++) total += __builtin_popcountll(a[i]);
+    return total;
+}
+
+static BK_AVX2 size_t bk_popcount_and_avx2(const uint64_t *a, const uint64_t *b, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        acc = _mm256_add_epi64(acc, bk_popcount256(_mm256_and_si256(va, vb)));
+    }
+    size_t total = bk_hsum256(acc);
+    for (; i < n; i++) total += __builtin_popcountll(a[i] & b[i]);
+    return total;
+}
+
+static BK_AVX2 bool bk_intersects_avx2(const uint64_t *a, const uint64_t *b, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        if (!_mm256_testz_si256(va, vb)) return true;
+    }
+    for (; i < n; i++)
+        if (a[i] & b[i]) return true;
+    return false;
+}
+
+static BK_AVX2 long bk_find_first_avx2(const uint64_t *a, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        if (!_mm256_testz_si256(va, va)) break;
+    }
+    if (i >= n) return -1;
+    long hit = bk_find_first_scalar(a + i, n - i);
+    return hit < 0 ? -1 : (long)(i * 64) + hit;
+}
+
+static BK_AVX2 long bk_find_first_andnot_avx2(const uint64_t *a, const uint64_t *b, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        if (!_mm256_testc_si256(vb, va)) break; /* some bit of a not covered by b */
+    }
+    if (i >= n) return -1;
+    long hit = bk_find_first_andnot_scalar(a + i, b + i, n - i);
+    return hit < 0 ? -1 : (long)(i * 64) + hit;
+}
+
+
+/* ---- AVX-512 (F + VPOPCNTDQ): 8 words per step, masked tails ---------- */
+
+#define BK_AVX512 __attribute__((target("avx512f,avx512vpopcntdq,popcnt")))
+
+static BK_AVX512 void bk_or_into_avx512(uint64_t *dst, const uint64_t *src, size_t n) {
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 m = n - i >= 8 ? 0xff : (__mmask8)((1u << (n - i)) - 1);
+        __m512i d = _mm512_maskz_loadu_epi64(m, dst + i);
+        __m512i s = _mm512_maskz_loadu_epi64(m, src + i);
+        _mm512_mask_storeu_epi64(dst + i, m, _mm512_or_si512(d, s));
+    }
+}
+
+static BK_AVX512 void bk_and_into_avx512(uint64_t *dst, const uint64_t *src, size_t n) {
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 m = n - i >= 8 ? 0xff : (__mmask8)((1u << (n - i)) - 1);
+        __m512i d = _mm512_maskz_loadu_epi64(m, dst + i);
+        __m512i s = _mm512_maskz_loadu_epi64(m, src + i);
+        _mm512_mask_storeu_epi64(dst + i, m, _mm512_and_si512(d, s));
+    }
+}
+
+static BK_AVX512 void bk_andnot_into_avx512(uint64_t *dst, const uint64_t *src, size_t n) {
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 m = n - i >= 8 ? 0xff : (__mmask8)((1u << (n - i)) - 1);
+        __m512i d = _mm512_maskz_loadu_epi64(m, dst + i);
+        __m512i s = _mm512_maskz_loadu_epi64(m, src + i);
+        _mm512_mask_storeu_epi64(dst + i, m, _mm512_maskz_andnot_epi64(m, s, d));
+    }
+}
+
+static BK_AVX512 void bk_andnot_copy_avx512(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 m = n - i >= 8 ? 0xff : (__mmask8)((1u << (n - i)) - 1);
+        __m512i va = _mm512_maskz_loadu_epi64(m, a + i);
+        __m512i vb = _mm512_maskz_loadu_epi64(m, b + i);
+        _mm512_mask_storeu_epi64(dst + i, m, _mm512_maskz_andnot_epi64(m, vb, va));
+    }
+}
+
+static BK_AVX512 size_t bk_hsum512(__m512i v) {
+    uint64_t lanes[8];
+    _mm512_storeu_si512((void *)lanes, v);
+    return (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7]);
+}
+
+static BK_AVX512 size_t bk_popcount_avx512(const uint64_t *a, size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 m = n - i >= 8 ? 0xff : (__mmask8)((1u << (n - i)) - 1);
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(m, a + i)));
+    }
+    return bk_hsum512(acc);
+}
+
+static BK_AVX512 size_t bk_popcount_and_avx512(const uint64_t *a, const uint64_t *b, size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 m = n - i >= 8 ? 0xff : (__mmask8)((1u << (n - i)) - 1);
+        __m512i va = _mm512_maskz_loadu_epi64(m, a + i);
+        __m512i vb = _mm512_maskz_loadu_epi64(m, b + i);
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_and_si512(va, vb)));
+    }
+    return bk_hsum512(acc);
+}
+
+static BK_AVX512 bool bk_intersects_avx512(const uint64_t *a, const uint64_t *b, size_t n) {
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 m = n - i >= 8 ? 0xff : (__mmask8)((1u << (n - i)) - 1);
+        __m512i va = _mm512_maskz_loadu_epi64(m, a + i);
+        __m512i vb = _mm512_maskz_loadu_epi64(m, b + i);
+        if (_mm512_test_epi64_mask(va, vb)) return true;
+    }
+    return false;
+}
+
+static BK_AVX512 long bk_find_first_avx512(const uint64_t *a, size_t n) {
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 m = n - i >= 8 ? 0xff : (__mmask8)((1u << (n - i)) - 1);
+        __m512i va = _mm512_maskz_loadu_epi64(m, a + i);
+        __mmask8 hit = _mm512_test_epi64_mask(va, va);
+        if (hit) {
+            size_t w = i + __builtin_ctz(hit);
+            return (long)(w * 64 + __builtin_ctzll(a[w]));
+        }
+    }
+    return -1;
+}
+
+static BK_AVX512 long bk_find_first_andnot_avx512(const uint64_t *a, const uint64_t *b, size_t n) {
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 m = n - i >= 8 ? 0xff : (__mmask8)((1u << (n - i)) - 1);
+        __m512i va = _mm512_maskz_loadu_epi64(m, a + i);
+        __m512i vb = _mm512_maskz_loadu_epi64(m, b + i);
+        __m512i bits = _mm512_maskz_andnot_epi64(m, vb, va);
+        __mmask8 hit = _mm512_test_epi64_mask(bits, bits);
+        if (hit) {
+            size_t w = i + __builtin_ctz(hit);
+            return (long)(w * 64 + __builtin_ctzll(a[w] & ~b[w]));
+        }
+    }
+    return -1;
+}
+
+#endif /* BK_X86 */
+
+
+static const bit_kernels bk_scalar_table = {
+    "scalar",
+    bk_or_into_scalar, bk_and_into_scalar, bk_andnot_into_scalar, bk_andnot_copy_scalar,
+    bk_popcount_scalar, bk_popcount_and_scalar, bk_intersects_scalar,
+    bk_find_first_scalar, bk_find_first_andnot_scalar
+};
+
+#ifdef BK_X86
+static const bit_kernels bk_avx2_table = {
+    "avx2",
+    bk_or_into_avx2, bk_and_into_avx2, bk_andnot_into_avx2, bk_andnot_copy_avx2,
+    bk_popcount_avx2, bk_popcount_and_avx2, bk_intersects_avx2,
+    bk_find_first_avx2, bk_find_first_andnot_avx2
+};
+
+static const bit_kernels bk_avx512_table = {
+    "avx512",
+    bk_or_into_avx512, bk_and_into_avx512, bk_andnot_into_avx512, bk_andnot_copy_avx512,
+    bk_popcount_avx512, bk_popcount_and_avx512, bk_intersects_avx512,
+    bk_find_first_avx512, bk_find_first_andnot_avx512
+};
+#endif
+
+/* Chosen once per translation unit. The pointer is published atomically:
+ * concurrent first calls may each probe the CPU, but all store the same
+ * table and readers always see a complete one */
+static inline const bit_kernels *bit_kernels_get(void) {
+    static const bit_kernels *selected = NULL;
+    const bit_kernels *cached = __atomic_load_n(&selected, __ATOMIC_ACQUIRE);
+    if (cached) return cached;
+    const bit_kernels *table = &bk_scalar_table;
+#ifdef BK_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vpopcntdq"))
+        table = &bk_avx512_table;
+    else if (__builtin_cpu_supports("avx2"))
+        table = &bk_avx2_table;
+#endif
+    __atomic_store_n(&selected, table, __ATOMIC_RELEASE);
+    return table;
+}
+
+#endif /* BIT_KERNELS_H */
@@ -0,0 +1,126 @@
+#ifndef BIT_MATRIX_HPP
+#define BIT_MATRIX_HPP
+
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <sys/mman.h>
+
+#include "blockPolicy.hpp"
+
+#define CACHE_LINE_BYTES 64
+#define HUGE_PAGE_BYTES (2 * 1024 * 1024)
+
+// rows x cols bit matrix in one contiguous, cache-line aligned allocation.
+// Every row starts on a cache line: the stride is padded to a multiple of
+// 64 bytes and the padding blocks stay zero. With hugePages set, matrices
+// of at least 2 MB are 2 MB aligned and advised as transparent huge pages.
+// attach() points the matrix at rows laid out the same way somewhere else
+// (a mapped cache file); such memory is never freed by the matrix.
+template <typename Block = Block64>
+class BitMatrix {
+public:
+    using block_t = typename Block::type;
+
+private:
+    int num_rows;
+    size_t row_blocks; // blocks holding the cols bits
+    size_t stride;     // blocks between two row starts
+    size_t byte_size;
+    block_t *data;
+    bool owned;        // false for attach()ed memory
+
+    void release() {
+        if (owned) std::free(data);
+        data = nullptr;
+        byte_size = 0;
+        owned = true;
+    }
+
+    void layout(int rows, int cols) {
+        num_rows = rows;
+        row_blocks = Block::blockCount(cols);
+        const size_t line_blocks = CACHE_LINE_BYTES / sizeof(block_t);
+        stride = (row_blocks + line_blocks - 1) / line_blocks * line_blocks;
+        byte_size = (size_t)rows * stride * sizeof(block_t);
+    }
+
+public:
+    BitMatrix() : num_rows(0), row_blocks(0), stride(0), byte_size(0), data(nullptr), owned(true) {}
+    BitMatrix(int rows, int cols, bool hugePages = false) : BitMatrix() { reset(rows, cols, hugePages); }
+    ~BitMatrix() { release(); }
+
+    BitMatrix(const BitMatrix&) = delete;
+    BitMatrix& operator=(const BitMatrix&) = delete;
+
+    BitMatrix(BitMatrix&& other) noexcept : BitMatrix() { *this = std::move(other); }
+    BitMatrix& operator=(BitMatrix&& other) noexcept {
+        if (this != &other) {
+            release();
+            num_rows = other.num_rows;
+            row_blocks = other.row_blocks;
+            stride = other.stride;
+            byte_size = other.byte_size;
+            data = other.data;
+            owned = other.owned;
+            other.data = nullptr;
+            other.owned = true;
+            other.num_rows = 0;
+            other.byte_size = 0;
+        }
+        return *this;
+    }
+
+    // Reallocates as an all-zero rows x cols matrix
+    void reset(int rows, int cols, bool hugePages = false) {
+        release();
+        layout(rows, cols);
+        if (byte_size == 0) return;
+
+        const bool huge = hugePages && byte_size >= HUGE_PAGE_BYTES;
+        const size_t alignment = huge ? HUGE_PAGE_BYTES : CACHE_LINE_BYTES;
+        const size_t alloc_size = (byte_size + alignment - 1) / alignment * alignment;
+        void *memory = nullptr;
+        if (posix_memalign(&memory, alignment, alloc_size) != 0) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+        if (huge) madvise(memory, alloc_size, MADV_HUGEPAGE);
+#endif
+        std::memset(memory, 0, alloc_size);
+        data = static_cast<block_t *>(memory);
+    }
+
+    // Uses rows x cols bits at external, which must already have this
+    // class's row stride and cache-line alignment; the caller keeps the
+    // memory alive for as long as the matrix is used
+    void attach(block_t *external, int rows, int cols) {
+        release();
+        layout(rows, cols);
+        data = external;
+        owned = false;
+    }
+
+    // Bytes between two row starts for a cols wide matrix, whatever the block
+    static size_t strideBytes(int cols) {
+        const size_t row_bytes = Block::blockCount(cols) * sizeof(block_t);
+        return (row_bytes + CACHE_LINE_BYTES - 1) / CACHE_LINE_BYTES * CACHE_LINE_BYTES;
+    }
+
+    int rows() const { return num_rows; }
+    size_t blocksPerRow() const { return row_blocks; }
+    size_t rowStride() const { return stride; }
+    size_t bytes() const { return byte_size; }
+
+    block_t *row(int r) { return data + (size_t)r * stride; }
+    const block_t *row(int r) const { return data + (size_t)r * stride; }
+
+    bool test(int r, int c) const { return Block::test(row(r), c); }
+    void set(int r, int c) { Block::set(row(r), c); }
+    void setEdge(int u, int v) {
+        set(u, v);
+        set(v, u);
+    }
+};
+
+#endif // BIT_MATRIX_HPP
@@ -0,0 +1,145 @@
+#ifndef BLOCK_POLICY_HPP
+#define BLOCK_POLICY_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+#include "bitKernels.h"
+
+// Block256 values are only returned from inline helpers, never across a
+// library boundary, so GCC's AVX return ABI warning does not apply. It is
+// silenced for the policies below only (the generic helpers call
+// Block256's too), not for the files including this one.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+// Block policies for the bitwise engines. A policy names the word type a
+// bit row is made of and the ctz/popcount/shift helpers for it, so the
+// engines can be instantiated for 32, 64, 128 and 256 bit blocks.
+//
+// Every block type stores bit i of a row at the same memory position as a
+// uint64_t row would (little endian), so rows whose block size is a
+// multiple of 64 bits go through the SIMD row kernels; others use the
+// generic per-block loops.
+template <typename Derived, typename T, int Bits>
+struct BlockPolicyBase {
+    using type = T;
+    static constexpr int bits = Bits;
+
+    static size_t blockIndex(int bit_index) { return bit_index / Bits; }
+    static size_t blockCount(int vertex_num) { return (vertex_num + Bits - 1) / Bits; }
+
+    static bool test(const T *row, int bit_index) {
+        return Derived::any(row[blockIndex(bit_index)] & Derived::mask(bit_index));
+    }
+    static void set(T *row, int bit_index) { row[blockIndex(bit_index)] |= Derived::mask(bit_index); }
+
+    // ---- row operations, n = blocks per row ----
+    static constexpr bool wordRows = sizeof(T) % sizeof(uint64_t) == 0;
+    static size_t words(size_t n) { return n * sizeof(T) / sizeof(uint64_t); }
+    static uint64_t *w(T *row) { return reinterpret_cast<uint64_t *>(row); }
+    static const uint64_t *w(const T *row) { return reinterpret_cast<const uint64_t *>(row); }
+
+    static void rowOr(const bit_kernels *k, T *dst, const T *src, size_t n) {
+        if constexpr (wordRows) k->or_into(w(dst), w(src), words(n));
+        else for (size_t i = 0; i < n; ++i) dst[i] |= src[i];
+    }
+    static void rowAndNot(const bit_kernels *k, T *dst, const T *src, size_t n) {
+        if constexpr (wordRows) k->andnot_into(w(dst), w(src), words(n));
+        else for (size_t i = 0; i < n; ++i) dst[i] &= ~src[i];
+    }
+    static void rowAndNotCopy(const bit_kernels *k, T *dst, const T *a, const T *b, size_t n) {
+        if constexpr (wordRows) k->andnot_copy(w(dst), w(a), w(b), words(n));
+        else for (size_t i = 0; i < n; ++i) dst[i] = a[i] & ~b[i];
+    }
+    static size_t rowPopcount(const bit_kernels *k, const T *a, size_t n) {
+        if constexpr (wordRows) return k->popcount(w(a), words(n));
+        size_t total = 0;
+        for (size_t i = 0; i < n; ++i) total += Derived::popcount(a[i]);
+        return total;
+    }
+    static bool rowIntersects(const bit_kernels *k, const T *a, const T *b, size_t n) {
+        if constexpr (wordRows) return k->intersects(w(a), w(b), words(n));
+        for (size_t i = 0; i < n; ++i)
+            if (Derived::any(a[i] & b[i])) return true;
+        return false;
+    }
+    static bool rowAny(const bit_kernels *k, const T *a, size_t n) {
+        if constexpr (wordRows) return k->find_first(w(a), words(n)) >= 0;
+        for (size_t i = 0; i < n; ++i)
+            if (Derived::any(a[i])) return true;
+        return false;
+    }
+};
+
+struct Block32 : BlockPolicyBase<Block32, uint32_t, 32> {
+    static constexpr const char *name = "32";
+    static type zero() { return 0; }
+    static type mask(int bit_index) { return (type)1 << (bit_index % bits); }
+    static bool any(type x) { return x != 0; }
+    static int ctz(type x) { return __builtin_ctz(x); }
+    static int popcount(type x) { return __builtin_popcount(x); }
+    static type clearLowest(type x) { return x & (x - 1); }
+};
+
+struct Block64 : BlockPolicyBase<Block64, uint64_t, 64> {
+    static constexpr const char *name = "64";
+    static type zero() { return 0; }
+    static type mask(int bit_index) { return (type)1 << (bit_index % bits); }
+    static bool any(type x) { return x != 0; }
+    static int ctz(type x) { return __builtin_ctzll(x); }
+    static int popcount(type x) { return __builtin_popcountll(x); }
+    static type clearLowest(type x) { return x & (x - 1); }
+};
+
+struct Block128 : BlockPolicyBase<Block128, unsigned __int128, 128> {
+    static constexpr const char *name = "128";
+    static type zero() { return 0; }
+    static type mask(int bit_index) { return (type)1 << (bit_index % bits); }
+    static bool any(type x) { return x != 0; }
+    static int ctz(type x) {
+        uint64_t lo = (uint64_t)x;
+        return lo ? __builtin_ctzll(lo) : 64 + __builtin_ctzll((uint64_t)(x >> 64));
+    }
+    static int popcount(type x) {
+        return __builtin_popcountll((uint64_t)x) + __builtin_popcountll((uint64_t)(x >> 64));
+    }
+    static type clearLowest(type x) { return x & (x - 1); }
+};
+
+// GCC vector of four 64-bit lanes; lane i holds bits 64*i .. 64*i + 63
+typedef uint64_t block256_t __attribute__((vector_size(32)));
+
+struct Block256 : BlockPolicyBase<Block256, block256_t, 256> {
+    static constexpr const char *name = "256";
+    static type zero() { return type{0, 0, 0, 0}; }
+    static type mask(int bit_index) {
+        type m = zero();
+        m[(bit_index % bits) / 64] = (uint64_t)1 << (bit_index % 64);
+        return m;
+    }
+    static bool any(const type& x) { return (x[0] | x[1] | x[2] | x[3]) != 0; }
+    static int ctz(const type& x) {
+        for (int lane = 0; lane < 4; ++lane)
+            if (x[lane]) return lane * 64 + __builtin_ctzll(x[lane]);
+        return bits;
+    }
+    static int popcount(const type& x) {
+        return __builtin_popcountll(x[0]) + __builtin_popcountll(x[1])
+             + __builtin_popcountll(x[2]) + __builtin_popcountll(x[3]);
+    }
+    static type clearLowest(const type& x) {
+        type y = x;
+        for (int lane = 0; lane < 4; ++lane) {
+            if (y[lane]) {
+                y[lane] &= y[lane] - 1;
+                break;
+            }
+        }
+        return y;
+    }
+};
+
+#pragma GCC diagnostic pop
+
+#endif // BLOCK_POLICY_HPP
@@ -0,0 +1,128 @@
+#ifndef COMPACT_DISTANCES_HPP
+#define COMPACT_DISTANCES_HPP
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+
+#include "blockPolicy.hpp"
+
+// Compact forms of one BFS distance vector (hop counts, -1 unreachable).
+// Both answer distance(v) and verticesAt(d) without expanding back to
+// vector<int>, and both can be filled from a plain distance vector.
+
+// One bitset per BFS level: level d holds the vertices at distance d. A
+// frontier-bitset BFS produces exactly these rows, and verticesAt(d) is
+// the row itself. Size is levels * N / 8 bytes, so it beats 4 bytes per
+// vertex while the graph has fewer than 32 levels.
+template <typename Block = Block64>
+class LevelDistances {
+public:
+    using block_t = typename Block::type;
+
+private:
+    int num_nodes = 0;
+    size_t block_num = 0;
+    std::vector<block_t> levels; // level-major, block_num blocks per level
+
+public:
+    void reset(int vertex_num) {
+        num_nodes = vertex_num;
+        block_num = Block::blockCount(vertex_num);
+        levels.clear();
+    }
+
+    void appendLevel(const block_t *bits) { levels.insert(levels.end(), bits, bits + block_num); }
+
+    void assign(const std::vector<int>& dist) {
+        reset((int)dist.size());
+        for (int v = 0; v < num_nodes; ++v) {
+            if (dist[v] < 0) continue;
+            if ((size_t)dist[v] >= levelCount()) levels.resize((dist[v] + 1) * block_num, Block::zero());
+            Block::set(level(dist[v]), v);
+        }
+    }
+
+    size_t levelCount() const { return block_num ? levels.size() / block_num : 0; }
+    const block_t *level(int d) const { return levels.data() + d * block_num; }
+    block_t *level(int d) { return levels.data() + d * block_num; }
+
+    int distance(int v) const {
+        for (size_t d = 0; d < levelCount(); ++d) {
+            if (Block::test(level(d), v)) return (int)d;
+        }
+        return -1;
+    }
+
+    std::vector<int> verticesAt(int d) const {
+        std::vector<int> result;
+        if (d < 0 || (size_t)d >= levelCount()) return result;
+        const block_t *row = level(d);
+        for (size_t b = 0; b < block_num; ++b) {
+            block_t bits = row[b];
+            while (Block::any(bits)) {
+                result.push_back(b * Block::bits + Block::ctz(bits));
+                bits = Block::clearLowest(bits);
+            }
+        }
+        return result;
+    }
+
+    size_t bytes() const { return levels.size() * sizeof(block_t); }
+};
+
+// One T per vertex (uint8_t or uint16_t). The largest value marks an
+// unreachable vertex; distances that do not fit below the escape value are
+// stored in a sorted (vertex, distance) overflow list.
+template <typename T = uint8_t>
+class PackedDistances {
+private:
+    static constexpr T UNREACHED = std::numeric_limits<T>::max();
+    static constexpr T ESCAPE = UNREACHED - 1;
+
+    std::vector<T> packed;
+    std::vector<std::pair<int, int>> overflow;
+
+public:
+    void assign(const std::vector<int>& dist) {
+        packed.resize(dist.size());
+        overflow.clear();
+        for (size_t v = 0; v < dist.size(); ++v) {
+            if (dist[v] < 0) packed[v] = UNREACHED;
+            else if (dist[v] < ESCAPE) packed[v] = (T)dist[v];
+            else {
+                packed[v] = ESCAPE;
+                overflow.push_back({(int)v, dist[v]});
+            }
+        }
+    }
+
+    int distance(int v) const {
+        const T d = packed[v];
+        if (d == UNREACHED) return -1;
+        if (d != ESCAPE) return d;
+        auto it = std::lower_bound(overflow.begin(), overflow.end(), std::make_pair(v, 0));
+        return it->second;
+    }
+
+    std::vector<int> verticesAt(int d) const {
+        std::vector<int> result;
+        if (d < 0) return result;
+        if (d < ESCAPE) {
+            for (size_t v = 0; v < packed.size(); ++v) {
+                if (packed[v] == d) result.push_back((int)v);
+            }
+        } else {
+            for (const auto &o : overflow) {
+                if (o.second == d) result.push_back(o.first);
+            }
+        }
+        return result;
+    }
+
+    size_t bytes() const { return packed.size() * sizeof(T) + overflow.size() * sizeof(overflow[0]); }
+};
+
+#endif // COMPACT_DISTANCES_HPP
@@ -0,0 +1,49 @@
+#ifndef COMPONENTS_HPP
+#define COMPONENTS_HPP
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+
+#include "resultWriter.hpp"
+
+// id[v] = component of v, sizes[c] = vertex count of component c. Ids
+// follow the smallest vertex of each component, so every engine returns
+// the same labelling for the same graph.
+struct Components {
+    std::vector<int> id;
+    std::vector<int> sizes;
+
+    // Renumbers arbitrary labels (any int in [0, label_num)) into the
+    // smallest-vertex order and fills sizes
+    void normalize(int label_num) {
+        std::vector<int> newId(label_num, -1);
+        sizes.clear();
+        for (size_t v = 0; v < id.size(); ++v) {
+            int &label = newId[id[v]];
+            if (label == -1) {
+                label = (int)sizes.size();
+                sizes.push_back(0);
+            }
+            id[v] = label;
+            ++sizes[label];
+        }
+    }
+
+    void write(const std::string& output_filename) const {
+        ResultWriter file(output_filename);
+        if (!file.is_open()) {
+            std::cerr << "File couldnt oppen!" << std::endl;
+            return;
+        }
+        for (size_t v = 0; v < id.size(); ++v) {
+            file << "Node " << v << " component: " << id[v] << "\n";
+        }
+        for (size_t c = 0; c < sizes.size(); ++c) {
+            file << "Component " << c << " size: " << sizes[c] << "\n";
+        }
+    }
+};
+
+#endif // COMPONENTS_HPP
@@ -0,0 +1,78 @@
+#ifndef CSR_GRAPH_HPP
+#define CSR_GRAPH_HPP
+
+#include <vector>
+#include <cstddef>
+
+#include "edgeStream.hpp"
+#include "parallelIngest.hpp"
+
+// Read-only CSR over arrays owned elsewhere: a CSRGraph or the sections
+// of a mapped graph cache file (graphLib/graphCache.hpp)
+struct CSRView {
+    int num_nodes = 0;
+    const int *offsets = nullptr;
+    const int *neighbors = nullptr;
+
+    int degree(int u) const { return offsets[u + 1] - offsets[u]; }
+    const int* begin(int u) const { return neighbors + offsets[u]; }
+    const int* end(int u) const { return neighbors + offsets[u + 1]; }
+
+    size_t memoryBytes() const {
+        return num_nodes == 0 ? 0 : ((size_t)num_nodes + 1 + offsets[num_nodes]) * sizeof(int);
+    }
+
+    // Lower bound of the same graph as vector<vector<int>>: one vector header
+    // and one heap block (16 byte malloc header) per vertex, no growth slack
+    size_t adjListMemoryBytes() const {
+        return num_nodes == 0 ? 0 : (size_t)num_nodes * (sizeof(std::vector<int>) + 16) + offsets[num_nodes] * sizeof(int);
+    }
+};
+
+// Compressed sparse row adjacency: neighbours of u are
+// neighbors[offsets[u] .. offsets[u + 1]). Built once from an edge stream,
+// every arc is stored in both directions like the adjacency list engines,
+// or only as u -> v in directed mode.
+struct CSRGraph {
+    int num_nodes = 0;
+    std::vector<int> offsets;
+    std::vector<int> neighbors;
+
+    CSRGraph() = default;
+    explicit CSRGraph(const EdgeSpan& stream, bool directed = false) { build(stream, directed); }
+
+    void build(const EdgeSpan& stream, bool directed = false) {
+        num_nodes = stream.num_nodes;
+        offsets.assign(num_nodes + 1, 0);
+        for (const Edge &e : stream.edges) {
+            ++offsets[e.u + 1];
+            if (!directed) ++offsets[e.v + 1];
+        }
+        for (int u = 0; u < num_nodes; ++u) offsets[u + 1] += offsets[u];
+
+        // Filled in stream order so neighbour order matches push_back adjacency lists
+        neighbors.resize(offsets[num_nodes]);
+        std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+        for (const Edge &e : stream.edges) {
+            neighbors[cursor[e.u]++] = e.v;
+            if (!directed) neighbors[cursor[e.v]++] = e.u;
+        }
+    }
+
+    // Same arrays built by the threads of pool (graphLib/parallelIngest.hpp)
+    void build(const EdgeSpan& stream, bool directed, ThreadPool& pool) {
+        num_nodes = stream.num_nodes;
+        buildCsrParallel(stream, directed, pool, offsets, neighbors);
+    }
+
+    int degree(int u) const { return offsets[u + 1] - offsets[u]; }
+    const int* begin(int u) const { return neighbors.data() + offsets[u]; }
+    const int* end(int u) const { return neighbors.data() + offsets[u + 1]; }
+
+    CSRView view() const { return CSRView{num_nodes, offsets.data(), neighbors.data()}; }
+
+    size_t memoryBytes() const { return view().memoryBytes(); }
+    size_t adjListMemoryBytes() const { return view().adjListMemoryBytes(); }
+};
+
+#endif // CSR_GRAPH_HPP
@@ -0,0 +1,32 @@
+#ifndef DIRECTED_BIT_MATRIX_HPP
+#define DIRECTED_BIT_MATRIX_HPP
+
+#include "bitMatrix.hpp"
+#include "edgeStream.hpp"
+
+// Directed mode: arcs are kept as given instead of being mirrored.
+// out.row(u) holds the heads of u's arcs, in.row(v) the tails of arcs
+// into v (the transpose), so both directions are a row scan away.
+template <typename Block = Block64>
+struct DirectedBitMatrix {
+    BitMatrix<Block> out;
+    BitMatrix<Block> in;
+    int num_nodes = 0;
+
+    DirectedBitMatrix() = default;
+    explicit DirectedBitMatrix(const EdgeSpan& stream) { build(stream); }
+
+    void build(const EdgeSpan& stream) {
+        num_nodes = stream.num_nodes;
+        out.reset(num_nodes, num_nodes, true);
+        in.reset(num_nodes, num_nodes, true);
+        for (const Edge &e : stream.edges) {
+            out.set(e.u, e.v);
+            in.set(e.v, e.u);
+        }
+    }
+
+    size_t blocksPerRow() const { return out.blocksPerRow(); }
+};
+
+#endif // DIRECTED_BIT_MATRIX_HPP
@@ -0,0 +1,132 @@
+#ifndef EDGE_STREAM_HPP
+#define EDGE_STREAM_HPP
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+#include "mappedFile.hpp"
+
+// One "a u v w" arc of a DIMACS file, vertices already 0 based
+struct Edge {
+    int u;
+    int v;
+    int w;
+};
+
+// Header and arc list of a DIMACS file, consumed by the representation builders
+struct EdgeStream {
+    int num_nodes = 0;
+    int edge_count = 0;
+    std::vector<Edge> edges;
+};
+
+// Read-only arcs somewhere in memory: an EdgeStream's vector or the mapped
+// edge section of the graph cache. Indexes and iterates like the vector.
+struct EdgeRange {
+    const Edge *first = nullptr;
+    size_t count = 0;
+
+    const Edge *begin() const { return first; }
+    const Edge *end() const { return first + count; }
+    const Edge *data() const { return first; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const Edge& operator[](size_t i) const { return first[i]; }
+};
+
+// EdgeStream without owning the arcs, so builders can read the cache's
+// edge section in place. Converts implicitly from an EdgeStream, which
+// must outlive the span.
+struct EdgeSpan {
+    int num_nodes = 0;
+    int edge_count = 0;
+    EdgeRange edges;
+
+    EdgeSpan() = default;
+    EdgeSpan(int num_nodes, int edge_count, const Edge *first, size_t count)
+        : num_nodes(num_nodes), edge_count(edge_count), edges{first, count} {}
+    EdgeSpan(const EdgeStream& stream)
+        : EdgeSpan(stream.num_nodes, stream.edge_count, stream.edges.data(), stream.edges.size()) {}
+};
+
+// Hand-rolled DIMACS scanner over the mapped file: no streams, no
+// locale, one pass over the bytes. p never passes end.
+namespace dimacs {
+
+inline const char *skipBlanks(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    return p;
+}
+
+inline const char *skipLine(const char *p, const char *end) {
+    while (p < end && *p != '\n') ++p;
+    return p < end ? p + 1 : p;
+}
+
+inline const char *skipToken(const char *p, const char *end) {
+    p = skipBlanks(p, end);
+    while (p < end && *p > ' ') ++p;
+    return p;
+}
+
+// Reads an optionally signed decimal; false if the line has no more numbers
+inline bool parseInt(const char *&p, const char *end, int& out) {
+    p = skipBlanks(p, end);
+    bool negative = false;
+    if (p < end && *p == '-') {
+        negative = true;
+        ++p;
+    }
+    if (p == end || (unsigned)(*p - '0') > 9) return false;
+    int value = 0;
+    do {
+        value = value * 10 + (*p - '0');
+        ++p;
+    } while (p < end && (unsigned)(*p - '0') <= 9);
+    out = negative ? -value : value;
+    return true;
+}
+
+// Appends the arcs of every line starting in [p, end) to stream and takes
+// the header from a "p" line; end must be a line start or the file end.
+// reserve sizes the arc list from the header (off for partial chunks).
+inline void scanLines(const char *p, const char *end, EdgeStream& stream, bool reserve = true) {
+    while (p < end) {
+        const char kind = *p;
+        if (kind == 'a') {
+            ++p;
+            Edge e;
+            e.w = 1; // ağırlıksız satırlarda 1
+            if (parseInt(p, end, e.u) && parseInt(p, end, e.v)) {
+                parseInt(p, end, e.w);
+                --e.u; // 1 tabanlıdan 0 tabanlıya
+                --e.v;
+                stream.edges.push_back(e);
+            }
+        } else if (kind == 'p') {
+            p = skipToken(p + 1, end); // problem type, "sp"
+            parseInt(p, end, stream.num_nodes);
+            parseInt(p, end, stream.edge_count);
+            if (reserve) stream.edges.reserve(stream.edge_count);
+        }
+        p = skipLine(p, end); // 'c' yorum satırları dahil
+    }
+}
+
+} // namespace dimacs
+
+inline EdgeStream readEdgeStream(const std::string& filename) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        std::cerr << "Dosya açılamadı: " << filename << std::endl;
+        exit(1);
+    }
+
+    EdgeStream stream;
+    dimacs::scanLines(file.data(), file.end(), stream);
+    return stream;
+}
+
+#endif // EDGE_STREAM_HPP
@@ -0,0 +1,254 @@
+#ifndef GRAPH_CACHE_HPP
+#define GRAPH_CACHE_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <utility>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "mappedFile.hpp"
+#include "edgeStream.hpp"
+#include "csrGraph.hpp"
+#include "weightedCsr.hpp"
+#include "bitMatrix.hpp"
+#include "parallelIngest.hpp"
+
+// 0 turns the cache off: every load parses the text file
+#ifndef GRAPH_CACHE
+#define GRAPH_CACHE 1
+#endif
+#define GRAPH_CACHE_SUFFIX ".bgc"
+#define GRAPH_CACHE_VERSION 2
+// The pre-built bit-matrix is stored up to 16384 vertices (32 MB)
+#define GRAPH_CACHE_MATRIX_MAX_NODES 16384
+#define GRAPH_CACHE_PAGE_BYTES 4096
+
+// Binary image of a DIMACS file, written next to it as "<file>.bgc" on the
+// first load and memory-mapped on every later one. After the header come,
+// each 64 byte aligned:
+//   edges      Edge[edge_num], stream order (what readEdgeStream returns)
+//   offsets    int[num_nodes + 1]  \  undirected CSR, same order as
+//   neighbors  int[arc_num]        /  CSRGraph::build(stream)
+//   arcs       WeightedArc[arc_num], {neighbors[i], weight}: the arcs of
+//              WeightedCSRGraph::build(stream), over the same offsets
+//   matrix     num_nodes rows of matrix_stride bytes (optional, page aligned)
+// The matrix rows have BitMatrix's layout, and since every block type keeps
+// bit i where a uint64_t row would, one section serves all block widths.
+// The size and mtime of the .txt are recorded; a changed source, another
+// version or a truncated file makes the image stale and it is rebuilt.
+struct GraphCacheHeader {
+    char magic[8];            // "BFSDFSGC"
+    uint32_t version;
+    uint32_t edge_bytes;      // sizeof(Edge) of the writer
+    int64_t source_size;
+    int64_t source_mtime_ns;
+    int32_t num_nodes;
+    int32_t edge_count;       // value of the "p" line
+    uint64_t edge_num;        // arcs actually read
+    uint64_t arc_num;         // 2 * edge_num
+    int64_t total_weight;     // over the input arcs, as WeightedCSRGraph keeps it
+    int32_t max_weight;
+    uint32_t arc_bytes;       // sizeof(WeightedArc) of the writer
+    uint64_t edges_offset;
+    uint64_t offsets_offset;
+    uint64_t neighbors_offset;
+    uint64_t arcs_offset;
+    uint64_t matrix_offset;   // 0 without a matrix
+    uint64_t matrix_stride;
+    uint64_t file_size;
+};
+
+class GraphCache {
+private:
+    MappedFile file;
+    const GraphCacheHeader *header = nullptr;
+
+    static constexpr char MAGIC[8] = {'B', 'F', 'S', 'D', 'F', 'S', 'G', 'C'};
+
+    static uint64_t alignUp(uint64_t x, uint64_t a) { return (x + a - 1) / a * a; }
+
+    static bool sourceStamp(const std::string& filename, int64_t& size, int64_t& mtime_ns) {
+        struct stat st;
+        if (stat(filename.c_str(), &st) != 0) return false;
+        size = (int64_t)st.st_size;
+        mtime_ns = (int64_t)st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+        return true;
+    }
+
+    template <typename T>
+    T *section(uint64_t offset) const { return reinterpret_cast<T *>(file.writableData() + offset); }
+
+    static bool writeAt(FILE *out, uint64_t& pos, uint64_t offset, const void *bytes, size_t n) {
+        static const char zeros[GRAPH_CACHE_PAGE_BYTES] = {};
+        while (pos < offset) {
+            size_t pad = (size_t)std::min<uint64_t>(offset - pos, sizeof(zeros));
+            if (fwrite(zeros, 1, pad, out) != pad) return false;
+            pos += pad;
+        }
+        if (n > 0 && fwrite(bytes, 1, n, out) != n) return false;
+        pos += n;
+        return true;
+    }
+
+public:
+    GraphCache() = default;
+    GraphCache(const GraphCache&) = delete;
+    GraphCache& operator=(const GraphCache&) = delete;
+
+    static std::string pathFor(const std::string& filename) { return filename + GRAPH_CACHE_SUFFIX; }
+
+    // Maps the image of filename; false when it is missing or stale
+    bool open(const std::string& filename) {
+        header = nullptr;
+        int64_t size, mtime_ns;
+        if (!sourceStamp(filename, size, mtime_ns)) return false;
+        if (!file.open(pathFor(filename), MapAccess::PrivateCopy)) return false;
+        if (file.size() < sizeof(GraphCacheHeader)) return false;
+
+        const GraphCacheHeader *h = reinterpret_cast<const GraphCacheHeader *>(file.data());
+        const uint64_t arc_end = h->arcs_offset + h->arc_num * sizeof(WeightedArc);
+        const uint64_t matrix_end = h->matrix_offset + (uint64_t)h->num_nodes * h->matrix_stride;
+        if (std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) != 0 || h->version != GRAPH_CACHE_VERSION
+            || h->edge_bytes != sizeof(Edge) || h->arc_bytes != sizeof(WeightedArc) || h->source_size != size || h->source_mtime_ns != mtime_ns
+            || h->file_size != file.size() || arc_end > file.size() || matrix_end > file.size()) {
+            return false;
+        }
+        header = h;
+        return true;
+    }
+
+    // Builds the image of stream (parsed from filename); written to a
+    // temporary name and renamed, so a reader never maps a half file. With
+    // a pool the CSR and matrix sections are built in parallel.
+    static bool write(const std::string& filename, const EdgeSpan& stream, ThreadPool *pool = nullptr) {
+        GraphCacheHeader h = {};
+        std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+        h.version = GRAPH_CACHE_VERSION;
+        h.edge_bytes = sizeof(Edge);
+        if (!sourceStamp(filename, h.source_size, h.source_mtime_ns)) return false;
+        h.num_nodes = stream.num_nodes;
+        h.edge_count = stream.edge_count;
+        h.edge_num = stream.edges.size();
+        h.arc_num = 2 * h.edge_num;
+        h.arc_bytes = sizeof(WeightedArc);
+        for (const Edge &e : stream.edges) {
+            h.total_weight += e.w;
+            if (e.w > h.max_weight) h.max_weight = e.w;
+        }
+
+        const int n = stream.num_nodes;
+        std::vector<int> offsets, neighbors, weights;
+        BitMatrix<Block64> matrix;
+        if (pool) {
+            buildCsrParallel(stream, false, *pool, offsets, neighbors, &weights);
+            if (n <= GRAPH_CACHE_MATRIX_MAX_NODES) buildBitMatrixParallel(matrix, stream, *pool);
+        } else {
+            offsets.assign(n + 1, 0);
+            for (const Edge &e : stream.edges) {
+                ++offsets[e.u + 1];
+                ++offsets[e.v + 1];
+            }
+            for (int u = 0; u < n; ++u) offsets[u + 1] += offsets[u];
+            neighbors.resize(h.arc_num);
+            weights.resize(h.arc_num);
+            std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+            for (const Edge &e : stream.edges) {
+                neighbors[cursor[e.u]] = e.v;
+                weights[cursor[e.u]++] = e.w;
+                neighbors[cursor[e.v]] = e.u;
+                weights[cursor[e.v]++] = e.w;
+            }
+            if (n <= GRAPH_CACHE_MATRIX_MAX_NODES) {
+                matrix.reset(n, n);
+                for (const Edge &e : stream.edges) matrix.setEdge(e.u, e.v);
+            }
+        }
+
+        std::vector<WeightedArc> arcs(h.arc_num);
+        for (size_t i = 0; i < h.arc_num; ++i) arcs[i] = {neighbors[i], weights[i]};
+        std::vector<int>().swap(weights);
+
+        h.edges_offset = alignUp(sizeof(GraphCacheHeader), CACHE_LINE_BYTES);
+        h.offsets_offset = alignUp(h.edges_offset + h.edge_num * sizeof(Edge), CACHE_LINE_BYTES);
+        h.neighbors_offset = alignUp(h.offsets_offset + offsets.size() * sizeof(int), CACHE_LINE_BYTES);
+        h.arcs_offset = alignUp(h.neighbors_offset + h.arc_num * sizeof(int), CACHE_LINE_BYTES);
+        h.file_size = h.arcs_offset + h.arc_num * sizeof(WeightedArc);
+        if (matrix.bytes() > 0) {
+            h.matrix_offset = alignUp(h.file_size, GRAPH_CACHE_PAGE_BYTES);
+            h.matrix_stride = BitMatrix<Block64>::strideBytes(n);
+            h.file_size = h.matrix_offset + matrix.bytes();
+        }
+
+        const std::string path = pathFor(filename);
+        const std::string tmp = path + ".tmp" + std::to_string(getpid());
+        FILE *out = fopen(tmp.c_str(), "wb");
+        if (!out) return false;
+        uint64_t pos = 0;
+        bool ok = writeAt(out, pos, 0, &h, sizeof(h))
+               && writeAt(out, pos, h.edges_offset, stream.edges.data(), h.edge_num * sizeof(Edge))
+               && writeAt(out, pos, h.offsets_offset, offsets.data(), offsets.size() * sizeof(int))
+               && writeAt(out, pos, h.neighbors_offset, neighbors.data(), h.arc_num * sizeof(int))
+               && writeAt(out, pos, h.arcs_offset, arcs.data(), h.arc_num * sizeof(WeightedArc));
+        if (ok && h.matrix_offset) ok = writeAt(out, pos, h.matrix_offset, matrix.row(0), matrix.bytes());
+        ok = fclose(out) == 0 && ok;
+        if (!ok || rename(tmp.c_str(), path.c_str()) != 0) {
+            std::remove(tmp.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // Mapped image of filename, parsed (by the pool's threads if given)
+    // and written first if needed; null when caching is off or the image
+    // cannot be written. In that case *parsed, if given, receives the
+    // parsed text, so the caller does not read the file a second time.
+    static std::shared_ptr<GraphCache> load(const std::string& filename, ThreadPool *pool = nullptr,
+                                            EdgeStream *parsed = nullptr) {
+        if (!GRAPH_CACHE && !parsed) return nullptr;
+        auto cache = std::make_shared<GraphCache>();
+        if (GRAPH_CACHE && cache->open(filename)) return cache;
+        EdgeStream stream = pool ? readEdgeStreamParallel(filename, *pool) : readEdgeStream(filename);
+        if (GRAPH_CACHE && write(filename, stream, pool) && cache->open(filename)) return cache;
+        if (parsed) *parsed = std::move(stream);
+        return nullptr;
+    }
+
+    int nodeCount() const { return header->num_nodes; }
+    int edgeCount() const { return header->edge_count; }
+    size_t edgeNum() const { return header->edge_num; }
+    size_t bytes() const { return file.size(); }
+
+    const Edge *edges() const { return section<const Edge>(header->edges_offset); }
+    CSRView csr() const {
+        return CSRView{header->num_nodes, section<const int>(header->offsets_offset),
+                       section<const int>(header->neighbors_offset)};
+    }
+
+    // Points g at the mapped offsets and weighted arcs, no copy
+    void attachWeighted(WeightedCSRGraph& g) const {
+        g.attach(header->num_nodes, section<const int>(header->offsets_offset),
+                 section<const WeightedArc>(header->arcs_offset), header->total_weight, header->max_weight);
+    }
+
+    // Edge section in place, no copy; valid while the cache is mapped
+    EdgeSpan edgeSpan() const { return EdgeSpan(header->num_nodes, header->edge_count, edges(), header->edge_num); }
+
+    bool hasMatrix() const { return header->matrix_offset != 0; }
+
+    // Points m at the mapped matrix rows, no copy; writes to the rows only
+    // touch private pages. False if the image has no matrix.
+    template <typename Block>
+    bool attachMatrix(BitMatrix<Block>& m) const {
+        if (!hasMatrix() || BitMatrix<Block>::strideBytes(header->num_nodes) != header->matrix_stride) return false;
+        m.attach(section<typename Block::type>(header->matrix_offset), header->num_nodes, header->num_nodes);
+        return true;
+    }
+};
+
+#endif // GRAPH_CACHE_HPP
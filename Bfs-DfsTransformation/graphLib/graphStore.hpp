@@ -0,0 +1,128 @@
+#ifndef GRAPH_STORE_HPP
+#define GRAPH_STORE_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <boost/graph/adjacency_list.hpp>
+
+#include "graphCache.hpp"
+#include "csrGraph.hpp"
+#include "weightedCsr.hpp"
+#include "bitMatrix.hpp"
+#include "parallelIngest.hpp"
+
+// One graph file loaded once. Each representation is built the first time
+// an engine asks for it and from then on shared read-only by every engine
+// reading the same store, so all of them are timed on identical data.
+// Builds are lazy and not synchronised: engines load one after another.
+// Engines keep pointers into the store, which must outlive them. Files of
+// PARALLEL_INGEST_MIN_BYTES and more are parsed, and their CSR and matrix
+// built, by a pool of max_threads threads (0 = all cores).
+class GraphStore {
+public:
+    using BoostGraph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
+    using AdjacencyList = std::vector<std::vector<int>>;
+
+private:
+    std::unique_ptr<ThreadPool> pool;  // only for large files
+    std::shared_ptr<GraphCache> cache; // mapped image, null when caching is off
+    std::unique_ptr<EdgeStream> stream;  // parsed text, only when there is no cache
+    std::unique_ptr<BoostGraph> bgl;
+    std::unique_ptr<AdjacencyList> adjList;
+    std::unique_ptr<CSRGraph> csrGraph;
+    std::unique_ptr<WeightedCSRGraph> weighted; // built, or attached to the cache
+    std::unique_ptr<BitMatrix<Block64>> matrix; // built, or attached to the cache
+    int num_nodes = 0;
+    int edge_count = 0;
+
+public:
+    explicit GraphStore(const std::string& filename, int max_threads = 0) {
+        if (parallelIngestWorthIt(filename)) {
+            pool = std::make_unique<ThreadPool>(max_threads);
+            if (pool->size() == 1) pool.reset();
+        }
+        EdgeStream parsed; // the text, when there is no image to map
+        cache = GraphCache::load(filename, pool.get(), &parsed);
+        if (cache) {
+            num_nodes = cache->nodeCount();
+            edge_count = cache->edgeCount();
+        } else {
+            stream = std::make_unique<EdgeStream>(std::move(parsed));
+            num_nodes = stream->num_nodes;
+            edge_count = stream->edge_count;
+        }
+    }
+
+    GraphStore(const GraphStore&) = delete;
+    GraphStore& operator=(const GraphStore&) = delete;
+
+    int nodeCount() const { return num_nodes; }
+    int edgeCount() const { return edge_count; }
+
+    // The arcs in stream order; with a cache the mapped section itself
+    EdgeSpan edges() const { return cache ? cache->edgeSpan() : EdgeSpan(*stream); }
+
+    const BoostGraph& boostGraph() {
+        if (!bgl) {
+            bgl = std::make_unique<BoostGraph>(num_nodes);
+            for (const Edge &e : edges().edges) boost::add_edge(e.u, e.v, *bgl);
+        }
+        return *bgl;
+    }
+
+    // Neighbours in stream order, both directions (as the adjacency list engines build it)
+    const AdjacencyList& adjacencyList() {
+        if (!adjList) {
+            adjList = std::make_unique<AdjacencyList>(num_nodes);
+            for (const Edge &e : edges().edges) {
+                (*adjList)[e.u].push_back(e.v);
+                (*adjList)[e.v].push_back(e.u);
+            }
+        }
+        return *adjList;
+    }
+
+    CSRView csr() {
+        if (cache) return cache->csr();
+        if (!csrGraph) {
+            csrGraph = std::make_unique<CSRGraph>();
+            if (pool) csrGraph->build(edges(), false, *pool);
+            else csrGraph->build(edges());
+        }
+        return csrGraph->view();
+    }
+
+    // Weighted CSR of the Dijkstra-style engines, read straight from the
+    // cache's arc section when there is one
+    const WeightedCSRGraph& weightedCsr() {
+        if (!weighted) {
+            weighted = std::make_unique<WeightedCSRGraph>();
+            if (cache) cache->attachWeighted(*weighted);
+            else weighted->build(edges());
+        }
+        return *weighted;
+    }
+
+    // Non-owning view of the undirected bit-matrix. Rows have the same byte
+    // layout for every block width, so all widths share one matrix; the
+    // rows must only be read.
+    template <typename Block>
+    BitMatrix<Block> bitMatrix() {
+        if (!matrix) {
+            matrix = std::make_unique<BitMatrix<Block64>>();
+            const bool mapped = cache && cache->attachMatrix(*matrix);
+            if (!mapped && pool) {
+                buildBitMatrixParallel(*matrix, edges(), *pool, true);
+            } else if (!mapped) {
+                matrix->reset(num_nodes, num_nodes, true);
+                for (const Edge &e : edges().edges) matrix->setEdge(e.u, e.v);
+            }
+        }
+        BitMatrix<Block> view;
+        view.attach(reinterpret_cast<typename Block::type *>(matrix->row(0)), num_nodes, num_nodes);
+        return view;
+    }
+};
+
+#endif // GRAPH_STORE_HPP
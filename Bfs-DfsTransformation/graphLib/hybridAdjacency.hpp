@@ -0,0 +1,81 @@
+#ifndef HYBRID_ADJACENCY_HPP
+#define HYBRID_ADJACENCY_HPP
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+#include "csrGraph.hpp"
+#include "bitMatrix.hpp"
+
+// Per-vertex choice between a bitset row and a sorted neighbour array.
+// Vertices with degree >= threshold get a BitMatrix row (a scan costs
+// N/64 words no matter how many neighbours), the rest keep a sorted,
+// duplicate free slice of one CSR style array. With threshold 0 the
+// cut-off is N/32: there a row scan costs at most half a list scan.
+class HybridAdjacency {
+private:
+    int num_nodes = 0;
+    int degree_threshold = 0;
+    std::vector<int> denseIndex;   // row in denseRows, -1 for sparse vertices
+    BitMatrix<Block64> denseRows;
+    std::vector<int> offsets;      // sparse vertices only, empty slice for dense ones
+    std::vector<int> neighbors;
+
+public:
+    HybridAdjacency() = default;
+    HybridAdjacency(const EdgeSpan& stream, int threshold = 0) { build(stream, threshold); }
+
+    void build(const EdgeSpan& stream, int threshold = 0) {
+        num_nodes = stream.num_nodes;
+        degree_threshold = threshold > 0 ? threshold : std::max(1, num_nodes / 32);
+
+        CSRGraph csr(stream);
+        std::vector<int> degree(num_nodes);
+        for (int u = 0; u < num_nodes; ++u) {
+            int *first = csr.neighbors.data() + csr.offsets[u];
+            int *last = csr.neighbors.data() + csr.offsets[u + 1];
+            std::sort(first, last);
+            degree[u] = (int)(std::unique(first, last) - first);
+        }
+
+        denseIndex.assign(num_nodes, -1);
+        int dense_count = 0;
+        for (int u = 0; u < num_nodes; ++u) {
+            if (degree[u] >= degree_threshold) denseIndex[u] = dense_count++;
+        }
+        denseRows.reset(dense_count, num_nodes, true);
+
+        offsets.assign(num_nodes + 1, 0);
+        for (int u = 0; u < num_nodes; ++u) {
+            offsets[u + 1] = offsets[u] + (denseIndex[u] < 0 ? degree[u] : 0);
+        }
+        neighbors.resize(offsets[num_nodes]);
+        for (int u = 0; u < num_nodes; ++u) {
+            const int *first = csr.neighbors.data() + csr.offsets[u];
+            if (denseIndex[u] < 0) {
+                std::copy(first, first + degree[u], neighbors.begin() + offsets[u]);
+            } else {
+                uint64_t *row = denseRows.row(denseIndex[u]);
+                for (int i = 0; i < degree[u]; ++i) Block64::set(row, first[i]);
+            }
+        }
+    }
+
+    int nodeCount() const { return num_nodes; }
+    int threshold() const { return degree_threshold; }
+    int denseCount() const { return denseRows.rows(); }
+
+    bool isDense(int u) const { return denseIndex[u] >= 0; }
+    const uint64_t *denseRow(int u) const { return denseRows.row(denseIndex[u]); }
+    size_t blocksPerRow() const { return Block64::blockCount(num_nodes); }
+
+    const int *sparseBegin(int u) const { return neighbors.data() + offsets[u]; }
+    const int *sparseEnd(int u) const { return neighbors.data() + offsets[u + 1]; }
+
+    size_t memoryBytes() const {
+        return denseRows.bytes() + (offsets.size() + neighbors.size() + denseIndex.size()) * sizeof(int);
+    }
+};
+
+#endif // HYBRID_ADJACENCY_HPP
@@ -0,0 +1,73 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <string>
+#include <cstddef>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// How a file is mapped: Sequential is a read-only map advised for one
+// front-to-back pass (text parsing); PrivateCopy maps the pages writable
+// but copy-on-write, so arrays inside the file can be handed to code that
+// takes non-const pointers without the file ever changing
+enum class MapAccess {
+    Sequential,
+    PrivateCopy
+};
+
+// Memory map of a whole file, unmapped on destruction. An empty file maps
+// to an empty range; open() returns false when the file cannot be opened
+// or mapped.
+class MappedFile {
+private:
+    char *base = nullptr;
+    size_t length = 0;
+
+    void close() {
+        if (base) munmap(base, length);
+        base = nullptr;
+        length = 0;
+    }
+
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& filename, MapAccess access = MapAccess::Sequential) {
+        close();
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+        length = (size_t)st.st_size;
+        if (length > 0) {
+            const int prot = access == MapAccess::PrivateCopy ? PROT_READ | PROT_WRITE : PROT_READ;
+            void *p = mmap(nullptr, length, prot, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                length = 0;
+                return false;
+            }
+            if (access == MapAccess::Sequential) madvise(p, length, MADV_SEQUENTIAL);
+            base = static_cast<char *>(p);
+        }
+        ::close(fd); // the mapping stays valid
+        return true;
+    }
+
+    const char *data() const { return base; }
+    const char *end() const { return base + length; }
+    // Only for PrivateCopy maps; writes stay private to this process
+    char *writableData() const { return base; }
+    size_t size() const { return length; }
+};
+
+#endif // MAPPED_FILE_HPP
@@ -0,0 +1,153 @@
+#ifndef PARALLEL_INGEST_HPP
+#define PARALLEL_INGEST_HPP
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <sys/stat.h>
+
+#include "mappedFile.hpp"
+#include "edgeStream.hpp"
+#include "bitMatrix.hpp"
+#include "threadPool.hpp"
+
+// Files smaller than this are parsed by one thread, below it waking the
+// pool costs more than the split saves
+#define PARALLEL_INGEST_MIN_BYTES (4 * 1024 * 1024)
+// Arcs per parallelFor chunk of the bit-matrix build
+#define PARALLEL_INGEST_GRAIN (1 << 16)
+
+// Parallel versions of the loading steps. Each produces exactly what the
+// sequential one does (same arc order, same CSR neighbour order), so the
+// engines see identical graphs whichever path built them.
+
+inline bool parallelIngestWorthIt(const std::string& filename) {
+    struct stat st;
+    return stat(filename.c_str(), &st) == 0 && (size_t)st.st_size >= PARALLEL_INGEST_MIN_BYTES;
+}
+
+// The mapped file is cut into one chunk per thread, every cut moved
+// forward to the next line start, and each thread scans its chunk into a
+// local arc list. The lists are then copied, in chunk order, into the
+// result, so arcs keep their file order.
+inline EdgeStream readEdgeStreamParallel(const std::string& filename, ThreadPool& pool) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        std::cerr << "Dosya açılamadı: " << filename << std::endl;
+        exit(1);
+    }
+
+    const int chunk_num = pool.size();
+    const char *begin = file.data(), *end = file.end();
+    std::vector<const char *> cuts(chunk_num + 1, end);
+    cuts[0] = begin;
+    for (int t = 1; t < chunk_num; ++t) {
+        const char *p = begin + file.size() * t / chunk_num;
+        if (p > begin && p[-1] != '\n') p = dimacs::skipLine(p, end);
+        cuts[t] = std::max(p, cuts[t - 1]);
+    }
+
+    std::vector<EdgeStream> local(chunk_num);
+    pool.run([&](int t) { dimacs::scanLines(cuts[t], cuts[t + 1], local[t], false); });
+
+    EdgeStream stream;
+    std::vector<size_t> first(chunk_num + 1, 0);
+    for (int t = 0; t < chunk_num; ++t) {
+        first[t + 1] = first[t] + local[t].edges.size();
+        if (local[t].num_nodes || local[t].edge_count) { // the last "p" line wins, as in readEdgeStream
+            stream.num_nodes = local[t].num_nodes;
+            stream.edge_count = local[t].edge_count;
+        }
+    }
+    stream.edges.resize(first[chunk_num]);
+    pool.run([&](int t) {
+        std::copy(local[t].edges.begin(), local[t].edges.end(), stream.edges.begin() + first[t]);
+        std::vector<Edge>().swap(local[t].edges);
+    });
+    return stream;
+}
+
+// CSR arrays with row ownership: thread t owns the vertices
+// [bounds[t], bounds[t + 1]). Each thread routes the arcs of its edge
+// range into one bucket per owner; an owner then reads its buckets in
+// thread order, which is stream order, counts its rows and fills them.
+// No two threads write the same row and nothing is locked. weights may
+// be null.
+inline void buildCsrParallel(const EdgeSpan& stream, bool directed, ThreadPool& pool,
+                             std::vector<int>& offsets, std::vector<int>& neighbors,
+                             std::vector<int> *weights = nullptr) {
+    struct Arc {
+        int u;
+        int v;
+        int w;
+    };
+    const int n = stream.num_nodes;
+    const int thread_num = pool.size();
+    const size_t edge_num = stream.edges.size();
+
+    std::vector<int> bounds(thread_num + 1);
+    for (int t = 0; t <= thread_num; ++t) bounds[t] = (int)(((size_t)t * n + thread_num - 1) / thread_num);
+    auto owner = [&](int v) { return (int)((size_t)v * thread_num / n); };
+
+    std::vector<std::vector<std::vector<Arc>>> buckets(thread_num, std::vector<std::vector<Arc>>(thread_num));
+    pool.run([&](int t) {
+        const size_t lo = edge_num * t / thread_num, hi = edge_num * (t + 1) / thread_num;
+        for (size_t i = lo; i < hi; ++i) {
+            const Edge &e = stream.edges[i];
+            buckets[t][owner(e.u)].push_back(Arc{e.u, e.v, e.w});
+            if (!directed) buckets[t][owner(e.v)].push_back(Arc{e.v, e.u, e.w});
+        }
+    });
+
+    std::vector<int> degree(n, 0);
+    std::vector<size_t> owned(thread_num + 1, 0);
+    pool.run([&](int o) {
+        for (int t = 0; t < thread_num; ++t) {
+            for (const Arc &a : buckets[t][o]) ++degree[a.u];
+            owned[o + 1] += buckets[t][o].size();
+        }
+    });
+    for (int o = 0; o < thread_num; ++o) owned[o + 1] += owned[o];
+
+    offsets.resize(n + 1);
+    offsets[n] = (int)owned[thread_num];
+    neighbors.resize(owned[thread_num]);
+    if (weights) weights->resize(owned[thread_num]);
+    pool.run([&](int o) {
+        int pos = (int)owned[o];
+        for (int u = bounds[o]; u < bounds[o + 1]; ++u) {
+            offsets[u] = pos;
+            pos += degree[u];
+            degree[u] = offsets[u]; // from here on the fill cursor of u
+        }
+        for (int t = 0; t < thread_num; ++t) {
+            for (const Arc &a : buckets[t][o]) {
+                const int slot = degree[a.u]++;
+                neighbors[slot] = a.v;
+                if (weights) (*weights)[slot] = a.w;
+            }
+            std::vector<Arc>().swap(buckets[t][o]);
+        }
+    });
+}
+
+// Undirected bit-matrix built by all threads at once. Both rows of an
+// edge are written by whichever thread holds the edge, so the bits are
+// set with an atomic fetch_or on the 64-bit word; setting a bit commutes,
+// so the result does not depend on the schedule.
+inline void buildBitMatrixParallel(BitMatrix<Block64>& m, const EdgeSpan& stream, ThreadPool& pool,
+                                   bool hugePages = false) {
+    m.reset(stream.num_nodes, stream.num_nodes, hugePages);
+    pool.parallelFor(0, stream.edges.size(), PARALLEL_INGEST_GRAIN, [&](int, size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            const Edge &e = stream.edges[i];
+            __atomic_fetch_or(m.row(e.u) + Block64::blockIndex(e.v), Block64::mask(e.v), __ATOMIC_RELAXED);
+            __atomic_fetch_or(m.row(e.v) + Block64::blockIndex(e.u), Block64::mask(e.u), __ATOMIC_RELAXED);
+        }
+    });
+}
+
+#endif // PARALLEL_INGEST_HPP
@@ -0,0 +1,81 @@
+#ifndef QUAD_HEAP_HPP
+#define QUAD_HEAP_HPP
+
+#include <vector>
+#include <cstdint>
+
+// Indexed 4-ary min-heap of vertices keyed by distance. Four children sit
+// next to each other, so a sift-down compares one cache line of entries,
+// and the tree is half as deep as a binary heap. pos[v] tracks where v
+// sits for decrease-key.
+class QuadHeap {
+private:
+    struct Entry {
+        int64_t key;
+        int vertex;
+    };
+
+    std::vector<Entry> heap;
+    std::vector<int> pos; // -1 = not in heap
+
+    void place(size_t i, const Entry& e) {
+        heap[i] = e;
+        pos[e.vertex] = (int)i;
+    }
+
+    void siftUp(size_t i, Entry e) {
+        while (i > 0) {
+            size_t parent = (i - 1) / 4;
+            if (heap[parent].key <= e.key) break;
+            place(i, heap[parent]);
+            i = parent;
+        }
+        place(i, e);
+    }
+
+    void siftDown(size_t i, Entry e) {
+        const size_t size = heap.size();
+        while (true) {
+            size_t first = 4 * i + 1;
+            if (first >= size) break;
+            size_t best = first;
+            size_t last = first + 4 < size ? first + 4 : size;
+            for (size_t c = first + 1; c < last; ++c) {
+                if (heap[c].key < heap[best].key) best = c;
+            }
+            if (heap[best].key >= e.key) break;
+            place(i, heap[best]);
+            i = best;
+        }
+        place(i, e);
+    }
+
+public:
+    void reset(int num_nodes) {
+        heap.clear();
+        pos.assign(num_nodes, -1);
+    }
+
+    bool empty() const { return heap.empty(); }
+
+    // Inserts v or lowers its key; a larger key is ignored
+    void push(int v, int64_t key) {
+        if (pos[v] < 0) {
+            heap.push_back({key, v});
+            siftUp(heap.size() - 1, {key, v});
+        } else if (key < heap[pos[v]].key) {
+            siftUp(pos[v], {key, v});
+        }
+    }
+
+    int pop() {
+        const int top = heap[0].vertex;
+        pos[top] = -1;
+        Entry last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) siftDown(0, last);
+        return top;
+    }
+};
+
+#endif // QUAD_HEAP_HPP
@@ -0,0 +1,229 @@
+#ifndef RESULT_WRITER_HPP
+#define RESULT_WRITER_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <type_traits>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "mappedFile.hpp"
+
+// Bytes gathered before one write() to the file
+#define RESULT_BUFFER_BYTES (1 << 20)
+// 1: distance and visit-order arrays go to "<output>.bin" as raw values,
+// the text file keeps only the other lines (convertResultToText restores it)
+#ifndef RESULT_BINARY
+#define RESULT_BINARY 0
+#endif
+#define RESULT_BINARY_SUFFIX ".bin"
+#define RESULT_BINARY_VERSION 1
+
+// Drop-in for the ofstream of the output files: operator<< formats with
+// std::to_chars straight into one reusable buffer, and each flush is a
+// single write() of it. Integers and doubles come out exactly as ostream
+// prints them (doubles as %g with 6 digits, bool as 0/1).
+class ResultWriter {
+private:
+    int fd = -1;
+    std::unique_ptr<char[]> buffer;
+    size_t used = 0;
+    bool failed = false;
+
+    static constexpr size_t NUMBER_BYTES = 32; // longest to_chars result
+
+    void put(const char *bytes, size_t n) {
+        if (used + n > RESULT_BUFFER_BYTES) {
+            flush();
+            if (n > RESULT_BUFFER_BYTES) { // bigger than the buffer, written as is
+                writeAll(bytes, n);
+                return;
+            }
+        }
+        std::memcpy(buffer.get() + used, bytes, n);
+        used += n;
+    }
+
+    template <typename... Format>
+    ResultWriter& number(Format... format) {
+        if (used + NUMBER_BYTES > RESULT_BUFFER_BYTES) flush();
+        char *p = buffer.get() + used;
+        used = std::to_chars(p, p + NUMBER_BYTES, format...).ptr - buffer.get();
+        return *this;
+    }
+
+    void writeAll(const char *bytes, size_t n) {
+        while (n > 0 && !failed) { // write() may take less than asked
+            ssize_t done = ::write(fd, bytes, n);
+            if (done < 0 && errno == EINTR) continue;
+            if (done <= 0) failed = true;
+            else {
+                bytes += done;
+                n -= (size_t)done;
+            }
+        }
+    }
+
+public:
+    ResultWriter() = default;
+    explicit ResultWriter(const std::string& filename) { open(filename); }
+    ~ResultWriter() { close(); }
+
+    ResultWriter(const ResultWriter&) = delete;
+    ResultWriter& operator=(const ResultWriter&) = delete;
+
+    bool open(const std::string& filename) {
+        close();
+        fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return false;
+        if (!buffer) buffer.reset(new char[RESULT_BUFFER_BYTES]);
+        failed = false;
+        return true;
+    }
+
+    bool is_open() const { return fd >= 0; }
+    bool good() const { return !failed; } // no write has failed so far
+
+    void flush() {
+        if (fd >= 0 && used > 0) writeAll(buffer.get(), used);
+        used = 0;
+    }
+
+    void close() {
+        if (fd < 0) return;
+        flush();
+        ::close(fd);
+        fd = -1;
+    }
+
+    ResultWriter& write(const char *bytes, size_t n) {
+        put(bytes, n);
+        return *this;
+    }
+
+    ResultWriter& operator<<(const char *s) { return write(s, std::strlen(s)); }
+    ResultWriter& operator<<(const std::string& s) { return write(s.data(), s.size()); }
+    ResultWriter& operator<<(char c) { return write(&c, 1); }
+    ResultWriter& operator<<(bool b) { return *this << (b ? '1' : '0'); }
+    ResultWriter& operator<<(double v) { return number(v, std::chars_format::general, 6); }
+
+    template <typename T,
+              typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>
+                                          && !std::is_same_v<T, char>>>
+    ResultWriter& operator<<(T v) { return number(v); }
+};
+
+// Compact result file: this header, then count values of value_bytes
+// each. uint16 is used when every value fits below 0xFFFF, and there
+// 0xFFFF stands for -1 (unreached); otherwise int32.
+enum class ResultKind : uint32_t {
+    Distance = 1,  // "Node s -> j shortest distance: d", BFS engines
+    VisitOrder = 2 // "Node s  -> j Shortest path: p", DFS engines
+};
+
+struct ResultFileHeader {
+    char magic[8];        // "BFSDFSRS"
+    uint32_t version;
+    uint32_t kind;        // ResultKind
+    uint32_t value_bytes; // 2 or 4
+    int32_t start;        // source vertex, its own line is not printed
+    uint64_t count;       // values, one per vertex
+};
+
+namespace result_detail {
+    constexpr char MAGIC[8] = {'B', 'F', 'S', 'D', 'F', 'S', 'R', 'S'};
+    constexpr uint16_t NARROW_NONE = 0xFFFF;
+}
+
+inline std::string binaryResultName(const std::string& output_filename) {
+    return output_filename + RESULT_BINARY_SUFFIX;
+}
+
+// Writes values as a compact result file; false on any I/O error
+inline bool writeBinaryResult(const std::string& filename, ResultKind kind, int start,
+                              const std::vector<int>& values) {
+    ResultFileHeader h = {};
+    std::memcpy(h.magic, result_detail::MAGIC, sizeof(h.magic));
+    h.version = RESULT_BINARY_VERSION;
+    h.kind = (uint32_t)kind;
+    h.start = start;
+    h.count = values.size();
+    bool narrow = true;
+    for (int v : values) narrow = narrow && v >= -1 && v < result_detail::NARROW_NONE;
+    h.value_bytes = narrow ? sizeof(uint16_t) : sizeof(int32_t);
+
+    ResultWriter out(filename);
+    if (!out.is_open()) return false;
+    out.write(reinterpret_cast<const char *>(&h), sizeof(h));
+    if (narrow) {
+        std::vector<uint16_t> narrowed(values.size());
+        for (size_t j = 0; j < values.size(); ++j) {
+            narrowed[j] = values[j] < 0 ? result_detail::NARROW_NONE : (uint16_t)values[j];
+        }
+        out.write(reinterpret_cast<const char *>(narrowed.data()), narrowed.size() * sizeof(uint16_t));
+    } else {
+        out.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(int32_t));
+    }
+    out.close();
+    return out.good();
+}
+
+// Text lines of a compact result file, byte for byte what the engine
+// prints for the array in text mode. False on a bad or short file.
+inline bool convertResultToText(const std::string& binary_filename, const std::string& text_filename) {
+    MappedFile in;
+    if (!in.open(binary_filename) || in.size() < sizeof(ResultFileHeader)) return false;
+    ResultFileHeader h;
+    std::memcpy(&h, in.data(), sizeof(h));
+    if (std::memcmp(h.magic, result_detail::MAGIC, sizeof(h.magic)) != 0 || h.version != RESULT_BINARY_VERSION
+        || (h.value_bytes != 2 && h.value_bytes != 4)
+        || (h.kind != (uint32_t)ResultKind::Distance && h.kind != (uint32_t)ResultKind::VisitOrder)
+        || in.size() != sizeof(h) + h.count * h.value_bytes) {
+        return false;
+    }
+
+    ResultWriter out(text_filename);
+    if (!out.is_open()) return false;
+    const char *values = in.data() + sizeof(h);
+    const bool distance = h.kind == (uint32_t)ResultKind::Distance;
+    for (uint64_t j = 0; j < h.count; ++j) {
+        if ((int64_t)j == h.start) continue;
+        int value;
+        if (h.value_bytes == 2) {
+            uint16_t x;
+            std::memcpy(&x, values + j * 2, sizeof(x));
+            value = x == result_detail::NARROW_NONE ? -1 : x;
+        } else {
+            std::memcpy(&value, values + j * 4, sizeof(value));
+        }
+        if (distance) out << "Node " << h.start << " -> " << j << " shortest distance: " << value << "\n";
+        else out << "Node " << h.start << "  -> " << j << " Shortest path: " << value << "\n";
+    }
+    out.close();
+    return out.good();
+}
+
+// Array block of a distance / visit-order output file: the text lines
+// into file, or with RESULT_BINARY the compact file next to it
+inline void writeResultArray(ResultWriter& file, const std::string& output_filename, ResultKind kind,
+                             int start, const std::vector<int>& values) {
+    if (RESULT_BINARY) {
+        if (!writeBinaryResult(binaryResultName(output_filename), kind, start, values)) {
+            std::cerr << "Sonuç dosyası yazılamadı: " << binaryResultName(output_filename) << std::endl;
+        }
+        return;
+    }
+    const char *label = kind == ResultKind::Distance ? " shortest distance: " : " Shortest path: ";
+    const char *arrow = kind == ResultKind::Distance ? " -> " : "  -> ";
+    for (size_t j = 0; j < values.size(); ++j) {
+        if ((int)j != start) file << "Node " << start << arrow << j << label << values[j] << "\n";
+    }
+}
+
+#endif // RESULT_WRITER_HPP
@@ -0,0 +1,22 @@
+#ifndef SIZE_BUCKETS_HPP
+#define SIZE_BUCKETS_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+// Row widths (in 64-bit words) of the size-specialized engines are 1, 2,
+// 4, 8 and 16: <= 64, <= 128, <= 256, <= 512 and <= 1024 vertices.
+// Calls fn(std::integral_constant<size_t, W>{}) with the smallest bucket
+// width W that holds num_nodes vertices. Returns false when the graph is
+// larger than every bucket and fn was not called.
+template <typename Fn>
+bool withSizeBucket(int num_nodes, Fn&& fn) {
+    if (num_nodes <= 64)   { fn(std::integral_constant<size_t, 1>{});  return true; }
+    if (num_nodes <= 128)  { fn(std::integral_constant<size_t, 2>{});  return true; }
+    if (num_nodes <= 256)  { fn(std::integral_constant<size_t, 4>{});  return true; }
+    if (num_nodes <= 512)  { fn(std::integral_constant<size_t, 8>{});  return true; }
+    if (num_nodes <= 1024) { fn(std::integral_constant<size_t, 16>{}); return true; }
+    return false;
+}
+
+#endif // SIZE_BUCKETS_HPP
@@ -0,0 +1,112 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <algorithm>
+
+// Fixed size pool used by the parallel engines. run() executes the same
+// function on every thread (the caller joins as thread 0) and returns when
+// all of them are done, so each call acts as one synchronous step.
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mtx;
+    std::condition_variable startCv;
+    std::condition_variable doneCv;
+    const std::function<void(int)> *task;
+    unsigned long generation;
+    int pending;
+    bool stopping;
+
+    void workerLoop(int tid) {
+        unsigned long seen = 0;
+        while (true) {
+            const std::function<void(int)> *current;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                startCv.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+                current = task;
+            }
+            (*current)(tid);
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (--pending == 0) doneCv.notify_one();
+            }
+        }
+    }
+
+public:
+    explicit ThreadPool(int thread_num = 0)
+        : task(nullptr), generation(0), pending(0), stopping(false) {
+        if (thread_num <= 0) thread_num = std::max(1u, std::thread::hardware_concurrency());
+        for (int tid = 1; tid < thread_num; ++tid) {
+            workers.emplace_back(&ThreadPool::workerLoop, this, tid);
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        startCv.notify_all();
+        for (auto &worker : workers) worker.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return (int)workers.size() + 1; }
+
+    // Runs fn(tid) for tid in [0, size()) and waits for all of them
+    void run(const std::function<void(int)>& fn) {
+        if (workers.empty()) {
+            fn(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            task = &fn;
+            pending = (int)workers.size();
+            ++generation;
+        }
+        startCv.notify_all();
+        fn(0);
+        std::unique_lock<std::mutex> lock(mtx);
+        doneCv.wait(lock, [&] { return pending == 0; });
+    }
+
+    // Splits [begin, end) into grain sized chunks handed out dynamically,
+    // fn(tid, lo, hi) is called once per chunk
+    void parallelFor(size_t begin, size_t end, size_t grain,
+                     const std::function<void(int, size_t, size_t)>& fn) {
+        if (begin >= end) return;
+        if (grain == 0) grain = 1;
+        std::atomic<size_t> cursor(begin);
+        run([&](int tid) {
+            while (true) {
+                size_t lo = cursor.fetch_add(grain, std::memory_order_relaxed);
+                if (lo >= end) break;
+                fn(tid, lo, std::min(end, lo + grain));
+            }
+        });
+    }
+};
+
+// Thread counts 1, 2, 4, ... up to max_threads (always included)
+inline std::vector<int> scalingSteps(int max_threads) {
+    if (max_threads <= 0) max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> steps;
+    for (int t = 1; t < max_threads; t *= 2) steps.push_back(t);
+    steps.push_back(max_threads);
+    return steps;
+}
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,97 @@
+#ifndef TRANSITIVE_CLOSURE_HPP
+#define TRANSITIVE_CLOSURE_HPP
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+#include "bitMatrix.hpp"
+#include "edgeStream.hpp"
+#include "threadPool.hpp"
+
+// Pivots handled together: one 64 bit word column, whose 64 pivot rows
+// stay in cache while every other row is updated against them
+#define CLOSURE_PIVOT_BLOCK 64
+
+// In-place reflexive transitive closure of a square bit matrix with
+// Warshall's algorithm, row i |= row k whenever bit (i, k) is set.
+// Pivots go in blocks of 64. The pivot rows are first closed over the
+// block sequentially, pivot by pivot as plain Warshall would, then every
+// other row is updated against those final pivot rows in parallel.
+// Using the final pivot rows only adds bits that are real paths, so the
+// result equals the sequential one.
+inline void transitiveClosure(BitMatrix<Block64>& m, ThreadPool& pool) {
+    const int num_nodes = m.rows();
+    const size_t block_num = m.blocksPerRow();
+    const bit_kernels *kernels = bit_kernels_get();
+    for (int v = 0; v < num_nodes; ++v) m.set(v, v);
+
+    for (int first = 0; first < num_nodes; first += CLOSURE_PIVOT_BLOCK) {
+        const int last = std::min(num_nodes, first + CLOSURE_PIVOT_BLOCK);
+        const size_t word = first / 64;
+
+        for (int k = first; k < last; ++k) {
+            for (int p = first; p < last; ++p) {
+                uint64_t *row = m.row(p);
+                if (p != k && Block64::test(row, k)) kernels->or_into(row, m.row(k), block_num);
+            }
+        }
+
+        pool.parallelFor(0, num_nodes, 16, [&](int, size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; ++i) {
+                if ((int)i >= first && (int)i < last) continue;
+                uint64_t *row = m.row(i);
+                // Bits set by this block's own ORs are pivots too, re-read the word
+                for (int k = first; k < last; ++k) {
+                    if (row[word] >> (k % 64) & 1) kernels->or_into(row, m.row(k), block_num);
+                }
+            }
+        });
+    }
+}
+
+// Answers "can s reach t" with one bit test on the precomputed closure.
+// Directed graphs follow arcs as given, undirected ones use both
+// directions like the traversal engines.
+class ReachabilityIndex {
+private:
+    BitMatrix<Block64> closure;
+    int num_nodes = 0;
+
+public:
+    ReachabilityIndex() = default;
+
+    void build(const EdgeSpan& stream, bool directed, ThreadPool& pool) {
+        num_nodes = stream.num_nodes;
+        closure.reset(num_nodes, num_nodes, true);
+        for (const Edge &e : stream.edges) {
+            if (directed) closure.set(e.u, e.v);
+            else closure.setEdge(e.u, e.v);
+        }
+        transitiveClosure(closure, pool);
+    }
+
+    int nodeCount() const { return num_nodes; }
+    size_t memoryBytes() const { return closure.bytes(); }
+
+    bool reachable(int s, int t) const { return closure.test(s, t); }
+
+    // Every vertex s reaches, as a bitset row
+    const uint64_t *reachableSet(int s) const { return closure.row(s); }
+
+    // answers[i] = reachable(queries[i].first, queries[i].second); the word
+    // of a later query is prefetched while the current one is tested
+    void reachableBatch(const std::vector<std::pair<int, int>>& queries, std::vector<char>& answers) const {
+        const size_t query_num = queries.size();
+        answers.resize(query_num);
+        for (size_t i = 0; i < query_num; ++i) {
+            if (i + 8 < query_num) {
+                const auto &ahead = queries[i + 8];
+                __builtin_prefetch(closure.row(ahead.first) + ahead.second / 64);
+            }
+            answers[i] = reachable(queries[i].first, queries[i].second);
+        }
+    }
+};
+
+#endif // TRANSITIVE_CLOSURE_HPP
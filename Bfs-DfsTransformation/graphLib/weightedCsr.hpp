@@ -0,0 +1,87 @@
+#ifndef WEIGHTED_CSR_GRAPH_HPP
+#define WEIGHTED_CSR_GRAPH_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "edgeStream.hpp"
+
+// Arc of the weighted CSR: head and weight side by side, so a relaxation
+// loop reads one cache line for both
+struct WeightedArc {
+    int v;
+    int w;
+};
+
+// CSRGraph with the DIMACS weights: arcs of u are
+// arcs[offsets[u] .. offsets[u + 1]), every arc stored in both directions
+// like the unweighted engines. build() fills its own arrays; attach()
+// points at the same layout somewhere else (the graph cache), no copy.
+struct WeightedCSRGraph {
+    int num_nodes = 0;
+    std::vector<int> offsets;      // empty when attached
+    std::vector<WeightedArc> arcs; // empty when attached
+    int64_t total_weight = 0; // over the input arcs
+    int max_weight = 0;
+
+private:
+    const int *row_offsets = nullptr;
+    const WeightedArc *arc_data = nullptr;
+    size_t arc_num = 0;
+
+public:
+    WeightedCSRGraph() = default;
+    explicit WeightedCSRGraph(const EdgeSpan& stream) { build(stream); }
+
+    // The arrays are fixed once built or attached: the pointers refer into them
+    WeightedCSRGraph(const WeightedCSRGraph&) = delete;
+    WeightedCSRGraph& operator=(const WeightedCSRGraph&) = delete;
+
+    void build(const EdgeSpan& stream) {
+        num_nodes = stream.num_nodes;
+        offsets.assign(num_nodes + 1, 0);
+        total_weight = 0;
+        max_weight = 0;
+        for (const Edge &e : stream.edges) {
+            ++offsets[e.u + 1];
+            ++offsets[e.v + 1];
+            total_weight += e.w;
+            if (e.w > max_weight) max_weight = e.w;
+        }
+        for (int u = 0; u < num_nodes; ++u) offsets[u + 1] += offsets[u];
+
+        arcs.resize(offsets[num_nodes]);
+        std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+        for (const Edge &e : stream.edges) {
+            arcs[cursor[e.u]++] = {e.v, e.w};
+            arcs[cursor[e.v]++] = {e.u, e.w};
+        }
+        row_offsets = offsets.data();
+        arc_data = arcs.data();
+        arc_num = arcs.size();
+    }
+
+    void attach(int vertex_num, const int *external_offsets, const WeightedArc *external_arcs,
+                int64_t weight_sum, int weight_max) {
+        num_nodes = vertex_num;
+        std::vector<int>().swap(offsets);
+        std::vector<WeightedArc>().swap(arcs);
+        total_weight = weight_sum;
+        max_weight = weight_max;
+        row_offsets = external_offsets;
+        arc_data = external_arcs;
+        arc_num = (size_t)external_offsets[vertex_num];
+    }
+
+    size_t arcCount() const { return arc_num; }
+    int degree(int u) const { return row_offsets[u + 1] - row_offsets[u]; }
+    const WeightedArc* begin(int u) const { return arc_data + row_offsets[u]; }
+    const WeightedArc* end(int u) const { return arc_data + row_offsets[u + 1]; }
+
+    size_t memoryBytes() const {
+        return (num_nodes + 1) * sizeof(int) + arc_num * sizeof(WeightedArc);
+    }
+};
+
+#endif // WEIGHTED_CSR_GRAPH_HPP
@@ -0,0 +1,20 @@
+#include <iostream>
+#include "string"
+
+#include "graphLib/resultWriter.hpp"
+
+using namespace std;
+
+// Turns a compact result file (written with RESULT_BINARY=1) back into
+// the text the engine prints: resultToText output_bfs_Csr.txt.bin out.txt
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        cerr << "Kullanım: " << argv[0] << " <sonuç.bin> <çıktı.txt>" << endl;
+        return 1;
+    }
+    if (!convertResultToText(argv[1], argv[2])) {
+        cerr << "Dosya dönüştürülemedi: " << argv[1] << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -6,6 +6,7 @@
 #include <string.h>
 
 #include "stdgraph.h"
+#include "graphLib/bitKernels.h"
 
 
 int comp_crit_1(const void* a, const void* b, void* metrics) {
@@ -209,12 +210,11 @@ bool is_valid(
 
 int count_edges(int graph_size, const block_t *edges, int degrees[]) {
     const block_t (*edges_p)[][TOTAL_BLOCK_NUM(graph_size)] = (block_t (*)[][TOTAL_BLOCK_NUM(graph_size)])edges;
-    memset(degrees, 0, graph_size*sizeof(int));
+    const bit_kernels *kernels = bit_kernels_get();
 
-    int i, j, total = 0;
+    int i, total = 0;
     for(i = 0; i < graph_size; i++) {
-        for(j = 0; j < TOTAL_BLOCK_NUM(graph_size); j++)
-            degrees[i] += popcountl((*edges_p)[i][j]);
+        degrees[i] = (int)kernels->popcount((*edges_p)[i], TOTAL_BLOCK_NUM(graph_size));
         total += degrees[i];
     }
 
@@ -264,6 +264,8 @@ int graph_color_greedy(
     block_t colors[][TOTAL_BLOCK_NUM(graph_size)], 
     int max_color_possible
 ) {
+    const bit_kernels *kernels = bit_kernels_get();
+
     // Go through the queue and color each vertex.
     int prob_queue[graph_size];
     block_t adjacent_colors[TOTAL_BLOCK_NUM(max_color_possible)];
@@ -276,10 +278,9 @@ int graph_color_greedy(
 
         // Initialize the temporary data.
         memset(adjacent_colors, 0, (TOTAL_BLOCK_NUM(max_color_possible))*sizeof(block_t));
-        for(j = 0; j < TOTAL_BLOCK_NUM(graph_size); j++)
-            for(k = 0; k < max_color_possible; k++)
-                if((edges[current_vert][j] & colors[k][j]))
-                    SET_COLOR(adjacent_colors, k);
+        for(k = 0; k < max_color_possible; k++)
+            if(kernels->intersects(edges[current_vert], colors[k], TOTAL_BLOCK_NUM(graph_size)))
+                SET_COLOR(adjacent_colors, k);
 
         // Find the first unused color (starting from 0) and assign this vertex to it.
         for(j = 0; j < max_color_possible; j++) {
@@ -302,13 +303,12 @@ int count_conflicts(
     int *conflict_count
 ) {
     block_t (*edges_p)[][TOTAL_BLOCK_NUM(graph_size)] = (block_t (*)[][TOTAL_BLOCK_NUM(graph_size)])edges;
+    const bit_kernels *kernels = bit_kernels_get();
 
-    int i, j, total_conflicts = 0;
+    int i, total_conflicts = 0;
     for(i = 0; i < graph_size; i++) {
         if(CHECK_COLOR(color, i)) {
-            conflict_count[i] = 0;
-            for(j = 0; j < TOTAL_BLOCK_NUM(graph_size); j++)
-                conflict_count[i] += popcountl(color[j] & (*edges_p)[i][j]);
+            conflict_count[i] = (int)kernels->popcount_and(color, (*edges_p)[i], TOTAL_BLOCK_NUM(graph_size));
             total_conflicts += conflict_count[i];
         }
     }